@@ -0,0 +1,139 @@
+#include "conversion/cast.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+namespace
+{
+
+//! Fields of one incoming request: a base64 payload, a digest to log in hex, a list of ids, tags and a user name from a wide API
+struct Request
+{
+    std::string m_Payload;
+    std::vector<char> m_Digest;
+    std::string m_Ids;
+    std::string m_Tags;
+    std::wstring m_Name;
+};
+
+const Request& Sample()
+{
+    static const Request request = []
+    {
+        Request result;
+        std::string payload;
+        for (int i = 0; i < 300; ++i)
+            payload.push_back(static_cast<char>(i * 37));
+        result.m_Payload = conv::cast<conv::Base64>(payload);
+        result.m_Digest.assign(payload.begin(), payload.begin() + 32);
+        result.m_Ids = "1024,77,18446744073709551615,9000001,42,314159,2718281,161803,0,65536";
+        result.m_Tags = "checkout,mobile,eu-west,retry,priority-high,beta";
+        result.m_Name = L"\x041F\x0440\x0438\x0432\x0435\x0442 \x043C\x0438\x0440 from a rather long display name";
+        return result;
+    }();
+    return request;
+}
+
+//! Every result of the request comes from the heap
+void Heap(benchmark::State& state)
+{
+    const Request& request = Sample();
+    for (auto _ : state)
+    {
+        const std::vector<char> payload = conv::cast<std::vector<char> >(request.m_Payload);
+        const std::string hex = conv::cast<conv::Hex>(request.m_Digest);
+        const std::vector<boost::uint64_t> ids = conv::cast<std::vector<boost::uint64_t> >(request.m_Ids);
+        const std::vector<std::string> tags = conv::cast<std::vector<std::string> >(request.m_Tags);
+        const std::string name = conv::cast<std::string>(request.m_Name);
+        benchmark::DoNotOptimize(payload.data());
+        benchmark::DoNotOptimize(hex.data());
+        benchmark::DoNotOptimize(ids.data());
+        benchmark::DoNotOptimize(tags.data());
+        benchmark::DoNotOptimize(name.data());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+//! The same results in an arena on the stack of the request, released at once at its end
+void Arena(benchmark::State& state)
+{
+    const Request& request = Sample();
+    for (auto _ : state)
+    {
+        char buffer[4096];
+        conv::MonotonicArena arena(buffer, sizeof(buffer));
+        const conv::Allocator<char> alloc(&arena);
+
+        const conv::Vector<char> payload = conv::cast<std::vector<char> >(request.m_Payload, alloc);
+        const conv::String hex = conv::cast<conv::Hex>(request.m_Digest, alloc);
+        const conv::Vector<boost::uint64_t> ids = conv::cast<std::vector<boost::uint64_t> >(request.m_Ids, alloc);
+        const conv::Vector<conv::String> tags = conv::cast<std::vector<std::string> >(request.m_Tags, alloc);
+        const conv::String name = conv::cast<std::string>(request.m_Name, alloc);
+        benchmark::DoNotOptimize(payload.data());
+        benchmark::DoNotOptimize(hex.data());
+        benchmark::DoNotOptimize(ids.data());
+        benchmark::DoNotOptimize(tags.data());
+        benchmark::DoNotOptimize(name.data());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+//! Arena without a buffer, the chunks come from the heap, a few per request instead of one per result
+void ArenaChunks(benchmark::State& state)
+{
+    const Request& request = Sample();
+    for (auto _ : state)
+    {
+        conv::MonotonicArena arena;
+        const conv::Allocator<char> alloc(&arena);
+
+        const conv::Vector<char> payload = conv::cast<std::vector<char> >(request.m_Payload, alloc);
+        const conv::String hex = conv::cast<conv::Hex>(request.m_Digest, alloc);
+        const conv::Vector<boost::uint64_t> ids = conv::cast<std::vector<boost::uint64_t> >(request.m_Ids, alloc);
+        const conv::Vector<conv::String> tags = conv::cast<std::vector<std::string> >(request.m_Tags, alloc);
+        const conv::String name = conv::cast<std::string>(request.m_Name, alloc);
+        benchmark::DoNotOptimize(payload.data());
+        benchmark::DoNotOptimize(hex.data());
+        benchmark::DoNotOptimize(ids.data());
+        benchmark::DoNotOptimize(tags.data());
+        benchmark::DoNotOptimize(name.data());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+//! Results of the previous request are refilled in place, their capacity is reused
+void Reuse(benchmark::State& state)
+{
+    const Request& request = Sample();
+    std::vector<char> payload;
+    std::string hex;
+    std::vector<boost::uint64_t> ids;
+    std::vector<std::string> tags;
+    std::string name;
+    for (auto _ : state)
+    {
+        conv::cast_into(payload, request.m_Payload);
+        conv::cast_into<conv::Hex>(hex, request.m_Digest);
+        conv::cast_into(ids, request.m_Ids);
+        conv::cast_into(tags, request.m_Tags);
+        conv::cast_into(name, request.m_Name);
+        benchmark::DoNotOptimize(payload.data());
+        benchmark::DoNotOptimize(hex.data());
+        benchmark::DoNotOptimize(ids.data());
+        benchmark::DoNotOptimize(tags.data());
+        benchmark::DoNotOptimize(name.data());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+} // namespace
+
+BENCHMARK(Heap);
+BENCHMARK(Arena);
+BENCHMARK(ArenaChunks);
+BENCHMARK(Reuse);
+BENCHMARK(Heap)->Threads(8);
+BENCHMARK(Arena)->Threads(8);
+BENCHMARK(Reuse)->Threads(8);
@@ -0,0 +1,129 @@
+#include "conversion/cast.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+const std::size_t g_Samples = 100000;
+
+//! Samples of the values with Zipf frequencies, the k-th most frequent value comes up in proportion to 1 / k^1.1
+std::vector<std::string> Zipf(const std::vector<std::string>& values)
+{
+    std::vector<double> weights(values.size());
+    for (std::size_t k = 0; k < values.size(); ++k)
+        weights[k] = 1 / std::pow(static_cast<double>(k + 1), 1.1);
+
+    std::mt19937 generator(42);
+    std::discrete_distribution<std::size_t> rank(weights.begin(), weights.end());
+    std::vector<std::string> result(g_Samples);
+    for (std::string& sample : result)
+        sample = values[rank(generator)];
+    return result;
+}
+
+//! HTTP like status codes
+const std::vector<std::string>& Codes()
+{
+    static const std::vector<std::string> samples = []
+    {
+        std::vector<std::string> values;
+        for (int code = 100; code < 600; code += 7)
+            values.push_back(conv::cast<std::string>(code));
+        return Zipf(values);
+    }();
+    return samples;
+}
+
+//! Base64 of 32 byte keys
+const std::vector<std::string>& Keys()
+{
+    static const std::vector<std::string> samples = []
+    {
+        std::mt19937 generator(7);
+        std::vector<std::string> values(10000);
+        for (std::string& value : values)
+        {
+            std::string key(32, '\0');
+            for (char& c : key)
+                c = static_cast<char>(generator());
+            value = conv::cast<conv::Base64>(key);
+        }
+        return Zipf(values);
+    }();
+    return samples;
+}
+
+//! Timestamps of events, many events share one
+const std::vector<std::string>& Timestamps()
+{
+    static const std::vector<std::string> samples = []
+    {
+        boost::posix_time::ptime time(boost::gregorian::date(2014, 10, 15), boost::posix_time::time_duration(17, 41, 52, 724658));
+        std::vector<std::string> values(10000);
+        for (std::string& value : values)
+        {
+            time += boost::posix_time::microseconds(1234);
+            value = conv::cast<std::string>(time) + "Z";
+        }
+        return Zipf(values);
+    }();
+    return samples;
+}
+
+template<typename Cast>
+void Run(benchmark::State& state, const std::vector<std::string>& samples, Cast cast)
+{
+    std::size_t index = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(cast(samples[index]));
+        if (++index == samples.size())
+            index = 0;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<typename Cached>
+void RunCached(benchmark::State& state, const std::vector<std::string>& samples)
+{
+    Cached::Clear();
+    Run(state, samples, Cached());
+    const conv::CacheStats stats = Cached::Stats();
+    state.counters["hit_rate"] = static_cast<double>(stats.Hits) / static_cast<double>(stats.Hits + stats.Misses);
+}
+
+void Code(benchmark::State& state) { Run(state, Codes(), [](const std::string& src) { return conv::cast<int>(src); }); }
+void CodeCached(benchmark::State& state) { RunCached<conv::CachedCaster<int> >(state, Codes()); }
+void Key(benchmark::State& state) { Run(state, Keys(), [](const std::string& src) { return conv::cast<std::vector<char> >(src); }); }
+void KeyCached(benchmark::State& state) { RunCached<conv::CachedCaster<std::vector<char> > >(state, Keys()); }
+void KeyCachedLarge(benchmark::State& state) { RunCached<conv::CachedCaster<std::vector<char>, std::string, 16384> >(state, Keys()); }
+void Timestamp(benchmark::State& state) { Run(state, Timestamps(), [](const std::string& src) { return conv::cast<boost::posix_time::ptime>(src); }); }
+void TimestampCached(benchmark::State& state) { RunCached<conv::CachedCaster<boost::posix_time::ptime> >(state, Timestamps()); }
+void TimestampCachedLarge(benchmark::State& state) { RunCached<conv::CachedCaster<boost::posix_time::ptime, std::string, 16384> >(state, Timestamps()); }
+
+//! Strict parsing goes through the date_time facet, the kind of slow caster a cache pays off for
+void Strict(benchmark::State& state) { Run(state, Timestamps(), [](const std::string& src) { return conv::cast<conv::StrictTime>(src); }); }
+void StrictCached(benchmark::State& state) { RunCached<conv::CachedCaster<conv::StrictTime> >(state, Timestamps()); }
+void StrictCachedLarge(benchmark::State& state) { RunCached<conv::CachedCaster<conv::StrictTime, std::string, 16384> >(state, Timestamps()); }
+
+} // namespace
+
+BENCHMARK(Code);
+BENCHMARK(CodeCached);
+BENCHMARK(Key);
+BENCHMARK(KeyCached);
+BENCHMARK(KeyCachedLarge);
+BENCHMARK(Timestamp);
+BENCHMARK(TimestampCached);
+BENCHMARK(TimestampCachedLarge);
+BENCHMARK(Strict);
+BENCHMARK(StrictCached);
+BENCHMARK(StrictCachedLarge);
@@ -0,0 +1,126 @@
+#include "conversion/cast.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+
+#include <cstdlib>
+#include <ctime>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+const std::size_t g_Count = 1024;
+
+//! Message timestamps over a year with microsecond precision
+std::vector<boost::posix_time::ptime> Times()
+{
+    std::mt19937_64 generator(42);
+    std::uniform_int_distribution<boost::int64_t> offset(0, boost::int64_t(365) * 86400 * 1000000);
+
+    const boost::posix_time::ptime start(boost::gregorian::date(2014, 1, 1));
+    std::vector<boost::posix_time::ptime> result(g_Count);
+    for (auto& value : result)
+        value = start + boost::posix_time::microseconds(offset(generator));
+    return result;
+}
+
+//! One cast call per timestamp
+template<typename Target>
+void Scalar(benchmark::State& state)
+{
+    const auto times = Times();
+    std::vector<typename conv::details::TypeTraits<Target>::Type> out(times.size());
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < times.size(); ++i)
+            out[i] = conv::cast<Target>(times[i]);
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * times.size());
+}
+
+//! Whole array at once
+template<typename Target>
+void Batch(benchmark::State& state)
+{
+    const auto times = Times();
+    std::vector<typename conv::details::TypeTraits<Target>::Type> out(times.size());
+    for (auto _ : state)
+    {
+        conv::cast<Target>(times.data(), times.data() + times.size(), out.data());
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * times.size());
+}
+
+//! Tagged counts back to time points
+template<typename From>
+void BatchToTime(benchmark::State& state)
+{
+    const auto times = Times();
+    std::vector<boost::uint64_t> counts(times.size());
+    conv::cast<From>(times.data(), times.data() + times.size(), counts.data());
+
+    std::vector<boost::posix_time::ptime> out(times.size());
+    for (auto _ : state)
+    {
+        conv::cast<boost::posix_time::ptime, From>(counts.data(), counts.data() + counts.size(), out.data());
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * times.size());
+}
+
+struct Berlin { static const char* Name() { return "Europe/Berlin"; } };
+
+//! Same zone through the C library, which takes a process wide lock on every call
+void LocaltimeR(benchmark::State& state)
+{
+    setenv("TZ", Berlin::Name(), 1);
+    tzset();
+
+    const auto times = Times();
+    std::vector<std::time_t> seconds;
+    for (const auto& time : times)
+        seconds.push_back(conv::cast<boost::uint32_t>(time));
+
+    std::vector<boost::posix_time::ptime> out(times.size());
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < times.size(); ++i)
+        {
+            std::tm local;
+            localtime_r(&seconds[i], &local);
+            out[i] = times[i] + boost::posix_time::seconds(local.tm_gmtoff);
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * times.size());
+}
+
+void TimeToMilliseconds(benchmark::State& state) { Scalar<boost::uint64_t>(state); }
+void TimeToSeconds(benchmark::State& state) { Scalar<boost::uint32_t>(state); }
+void TimeToMicroseconds(benchmark::State& state) { Scalar<conv::EpochMicroseconds>(state); }
+void TimeToNanoseconds(benchmark::State& state) { Scalar<conv::EpochNanoseconds>(state); }
+void BatchTimeToMilliseconds(benchmark::State& state) { Batch<boost::uint64_t>(state); }
+void BatchTimeToMicroseconds(benchmark::State& state) { Batch<conv::EpochMicroseconds>(state); }
+void BatchTimeToNanoseconds(benchmark::State& state) { Batch<conv::EpochNanoseconds>(state); }
+void BatchMicrosecondsToTime(benchmark::State& state) { BatchToTime<conv::EpochMicroseconds>(state); }
+void BatchNanosecondsToTime(benchmark::State& state) { BatchToTime<conv::EpochNanoseconds>(state); }
+void TimeToLocal(benchmark::State& state) { Scalar<conv::LocalTime<Berlin> >(state); }
+
+} // namespace
+
+BENCHMARK(TimeToMilliseconds);
+BENCHMARK(TimeToSeconds);
+BENCHMARK(TimeToMicroseconds);
+BENCHMARK(TimeToNanoseconds);
+BENCHMARK(BatchTimeToMilliseconds);
+BENCHMARK(BatchTimeToMicroseconds);
+BENCHMARK(BatchTimeToNanoseconds);
+BENCHMARK(BatchMicrosecondsToTime);
+BENCHMARK(BatchNanosecondsToTime);
+BENCHMARK(TimeToLocal);
+BENCHMARK(LocaltimeR);
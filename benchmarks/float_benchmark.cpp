@@ -0,0 +1,97 @@
+#include "conversion/cast.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+const std::size_t g_Count = 1024;
+
+//! Values spread over the whole exponent range
+template<typename T>
+std::vector<T> RandomValues()
+{
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<T> mantissa(1, 10);
+    std::uniform_int_distribution<int> exponent(std::numeric_limits<T>::min_exponent10 + 1, std::numeric_limits<T>::max_exponent10 - 1);
+
+    std::vector<T> result(g_Count);
+    for (T& value : result)
+        value = mantissa(generator) * std::pow(T(10), T(exponent(generator)));
+    return result;
+}
+
+//! Prices, quantities and percentages with a few decimal places
+template<typename T>
+std::vector<T> HumanValues()
+{
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> cents(0, 1000000);
+    std::uniform_int_distribution<int> scale(0, 3);
+
+    std::vector<T> result(g_Count);
+    for (T& value : result)
+        value = T(cents(generator)) / std::pow(T(10), T(scale(generator)));
+    return result;
+}
+
+template<typename T>
+void Shortest(benchmark::State& state, const std::vector<T>& values)
+{
+    std::size_t index = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(conv::cast<std::string>(values[index++ % values.size()]));
+    }
+}
+
+//! Same digits into a FixedString on the stack
+template<typename T>
+void Inline(benchmark::State& state, const std::vector<T>& values)
+{
+    std::size_t index = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(conv::cast<conv::Inline<T> >(values[index++ % values.size()]));
+    }
+}
+
+template<typename T>
+void LexicalCast(benchmark::State& state, const std::vector<T>& values)
+{
+    std::size_t index = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(boost::lexical_cast<std::string>(values[index++ % values.size()]));
+    }
+}
+
+void FloatRandom(benchmark::State& state) { Shortest(state, RandomValues<float>()); }
+void FloatHuman(benchmark::State& state) { Shortest(state, HumanValues<float>()); }
+void DoubleRandom(benchmark::State& state) { Shortest(state, RandomValues<double>()); }
+void DoubleHuman(benchmark::State& state) { Shortest(state, HumanValues<double>()); }
+
+void FloatRandomInline(benchmark::State& state) { Inline(state, RandomValues<float>()); }
+void DoubleRandomInline(benchmark::State& state) { Inline(state, RandomValues<double>()); }
+
+void FloatRandomLexicalCast(benchmark::State& state) { LexicalCast(state, RandomValues<float>()); }
+void FloatHumanLexicalCast(benchmark::State& state) { LexicalCast(state, HumanValues<float>()); }
+void DoubleRandomLexicalCast(benchmark::State& state) { LexicalCast(state, RandomValues<double>()); }
+void DoubleHumanLexicalCast(benchmark::State& state) { LexicalCast(state, HumanValues<double>()); }
+
+} // namespace
+
+BENCHMARK(FloatRandom);
+BENCHMARK(FloatHuman);
+BENCHMARK(DoubleRandom);
+BENCHMARK(DoubleHuman);
+BENCHMARK(FloatRandomInline);
+BENCHMARK(DoubleRandomInline);
+BENCHMARK(FloatRandomLexicalCast);
+BENCHMARK(FloatHumanLexicalCast);
+BENCHMARK(DoubleRandomLexicalCast);
+BENCHMARK(DoubleHumanLexicalCast);
@@ -0,0 +1,82 @@
+//! Compile-time cost of the public headers: preprocessed size and parse time of a translation unit including only one header
+
+#include <benchmark/benchmark.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+namespace
+{
+
+std::string Command(const char* header, const char* mode)
+{
+    return std::string(CONVERSION_CXX_COMPILER) + " -std=c++14 -x c++ " + mode
+        + " -I" + CONVERSION_INCLUDE_DIR + " -I" + CONVERSION_BOOST_INCLUDE_DIR
+        + " -include " + header + " /dev/null";
+}
+
+void Preprocess(benchmark::State& state, const char* header)
+{
+    const std::string command = Command(header, "-E -P");
+
+    std::size_t size = 0;
+    for (auto _ : state)
+    {
+        FILE* const pipe = popen(command.c_str(), "r");
+        if (!pipe)
+        {
+            state.SkipWithError("failed to run the compiler");
+            return;
+        }
+
+        char buffer[65536];
+        size = 0;
+        while (const std::size_t read = std::fread(buffer, 1, sizeof(buffer), pipe))
+            size += read;
+
+        if (pclose(pipe))
+        {
+            state.SkipWithError("preprocessing failed");
+            return;
+        }
+    }
+
+    state.counters["bytes"] = static_cast<double>(size);
+}
+
+void Parse(benchmark::State& state, const char* header)
+{
+    const std::string command = Command(header, "-fsyntax-only");
+
+    for (auto _ : state)
+    {
+        if (std::system(command.c_str()))
+        {
+            state.SkipWithError("parsing failed");
+            return;
+        }
+    }
+}
+
+} // namespace
+
+#define HEADER_BENCHMARK(name, header) \
+    BENCHMARK_CAPTURE(Preprocess, name, header)->Unit(benchmark::kMillisecond)->UseRealTime()->Iterations(3); \
+    BENCHMARK_CAPTURE(Parse, name, header)->Unit(benchmark::kMillisecond)->UseRealTime()->Iterations(3)
+
+HEADER_BENCHMARK(caster, "conversion/details/caster.hpp");
+HEADER_BENCHMARK(numeric, "conversion/numeric.hpp");
+HEADER_BENCHMARK(fixed, "conversion/fixed.hpp");
+HEADER_BENCHMARK(text, "conversion/text.hpp");
+HEADER_BENCHMARK(time, "conversion/time.hpp");
+HEADER_BENCHMARK(chrono, "conversion/chrono.hpp");
+HEADER_BENCHMARK(zone, "conversion/zone.hpp");
+HEADER_BENCHMARK(binary, "conversion/binary.hpp");
+HEADER_BENCHMARK(list, "conversion/list.hpp");
+HEADER_BENCHMARK(allocator, "conversion/allocator.hpp");
+HEADER_BENCHMARK(cache, "conversion/cache.hpp");
+HEADER_BENCHMARK(lazy, "conversion/lazy.hpp");
+HEADER_BENCHMARK(literal, "conversion/literal.hpp");
+HEADER_BENCHMARK(pipe, "conversion/pipe.hpp");
+HEADER_BENCHMARK(cast, "conversion/cast.hpp");
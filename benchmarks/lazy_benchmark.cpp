@@ -0,0 +1,116 @@
+#include "conversion/cast.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+//! Row of a decoded batch, every field is still text
+struct Row
+{
+    std::string m_Id;
+    std::string m_Time;
+    std::string m_Attachment;
+};
+
+//! Thousand rows with a 300 byte base64 attachment each
+const std::vector<Row>& Rows()
+{
+    static const std::vector<Row> rows = []
+    {
+        std::mt19937 generator(42);
+        boost::posix_time::ptime time(boost::gregorian::date(2014, 10, 15), boost::posix_time::time_duration(17, 41, 52, 724658));
+        std::vector<Row> result(1000);
+        for (Row& row : result)
+        {
+            std::string attachment(300, '\0');
+            for (char& c : attachment)
+                c = static_cast<char>(generator());
+            time += boost::posix_time::microseconds(generator() % 100000);
+            row.m_Id = conv::cast<std::string>(generator() % 1000000);
+            row.m_Time = conv::cast<std::string>(time) + "Z";
+            row.m_Attachment = conv::cast<conv::Base64>(attachment);
+        }
+        return result;
+    }();
+    return rows;
+}
+
+//! Reads the time and the attachment only for ids divisible by every, as a filter would
+template<typename Id, typename Time, typename Attachment>
+std::size_t Consume(const Id& id, const Time& time, const Attachment& attachment, const boost::uint64_t every)
+{
+    if (static_cast<boost::uint64_t>(id) % every)
+        return 0;
+    const boost::posix_time::ptime& value = time;
+    const std::vector<char>& bytes = attachment;
+    return static_cast<std::size_t>(value.time_of_day().ticks()) + bytes.size();
+}
+
+//! Every field is cast when the row is decoded
+void Eager(benchmark::State& state)
+{
+    const boost::uint64_t every = static_cast<boost::uint64_t>(state.range(0));
+    for (auto _ : state)
+    {
+        std::size_t total = 0;
+        for (const Row& row : Rows())
+        {
+            const int id = conv::cast<int>(row.m_Id);
+            const boost::posix_time::ptime time = conv::cast<boost::posix_time::ptime>(row.m_Time);
+            const std::vector<char> attachment = conv::cast<std::vector<char> >(row.m_Attachment);
+            total += Consume(id, time, attachment, every);
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * Rows().size());
+}
+
+//! Fields are cast when the filter reads them
+void Lazy(benchmark::State& state)
+{
+    const boost::uint64_t every = static_cast<boost::uint64_t>(state.range(0));
+    for (auto _ : state)
+    {
+        std::size_t total = 0;
+        for (const Row& row : Rows())
+        {
+            const auto id = conv::lazy_cast<int>(row.m_Id);
+            const auto time = conv::lazy_cast<boost::posix_time::ptime>(row.m_Time);
+            const auto attachment = conv::lazy_cast<std::vector<char> >(row.m_Attachment);
+            total += Consume(id.Get(), time, attachment, every);
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * Rows().size());
+}
+
+void SharedLazy(benchmark::State& state)
+{
+    const boost::uint64_t every = static_cast<boost::uint64_t>(state.range(0));
+    for (auto _ : state)
+    {
+        std::size_t total = 0;
+        for (const Row& row : Rows())
+        {
+            const auto id = conv::shared_lazy_cast<int>(row.m_Id);
+            const auto time = conv::shared_lazy_cast<boost::posix_time::ptime>(row.m_Time);
+            const auto attachment = conv::shared_lazy_cast<std::vector<char> >(row.m_Attachment);
+            total += Consume(id.Get(), time, attachment, every);
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * Rows().size());
+}
+
+} // namespace
+
+BENCHMARK(Eager)->Arg(1)->Arg(10)->Arg(100);
+BENCHMARK(Lazy)->Arg(1)->Arg(10)->Arg(100);
+BENCHMARK(SharedLazy)->Arg(1)->Arg(10)->Arg(100);
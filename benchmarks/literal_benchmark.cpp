@@ -0,0 +1,59 @@
+#include "conversion/cast.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+//! Defaults of a config as they are usually written, parsed on every call
+void Cast(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(conv::cast<int>("1234567890"));
+        benchmark::DoNotOptimize(conv::cast<bool>("true"));
+        benchmark::DoNotOptimize(conv::cast<std::vector<char>, conv::Hex>(std::string("deadbeefdeadbeef")));
+        benchmark::DoNotOptimize(conv::cast<std::vector<char> >(std::string("aGVsbG8gd29ybGQ=")));
+    }
+    state.SetItemsProcessed(state.iterations() * 4);
+}
+
+//! The same literals parsed at run time by literal_cast, no string is built
+void Literal(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(conv::literal_cast<int>("1234567890"));
+        benchmark::DoNotOptimize(conv::literal_cast<bool>("true"));
+        benchmark::DoNotOptimize(conv::literal_cast<std::array<char, 8>, conv::Hex>("deadbeefdeadbeef"));
+        benchmark::DoNotOptimize(conv::literal_cast<std::array<char, 11> >("aGVsbG8gd29ybGQ="));
+    }
+    state.SetItemsProcessed(state.iterations() * 4);
+}
+
+//! Constant expressions, nothing is left to do at run time
+void Constant(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        constexpr int number = conv::literal_cast<int>("1234567890");
+        constexpr bool flag = conv::literal_cast<bool>("true");
+        constexpr auto hex = conv::literal_cast<std::array<char, 8>, conv::Hex>("deadbeefdeadbeef");
+        constexpr auto base64 = conv::literal_cast<std::array<char, 11> >("aGVsbG8gd29ybGQ=");
+        benchmark::DoNotOptimize(number);
+        benchmark::DoNotOptimize(flag);
+        benchmark::DoNotOptimize(hex);
+        benchmark::DoNotOptimize(base64);
+    }
+    state.SetItemsProcessed(state.iterations() * 4);
+}
+
+} // namespace
+
+BENCHMARK(Cast);
+BENCHMARK(Literal);
+BENCHMARK(Constant);
@@ -0,0 +1,82 @@
+#include "conversion/cast.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+const std::size_t g_Count = 1024;
+
+std::vector<std::string> Integers()
+{
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> value(-1000000, 1000000);
+
+    std::vector<std::string> result(g_Count);
+    for (std::string& item : result)
+        item = std::to_string(value(generator));
+    return result;
+}
+
+std::vector<std::string> Doubles()
+{
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> value(-1000, 1000);
+
+    std::vector<std::string> result(g_Count);
+    for (std::string& item : result)
+        item = conv::cast<std::string>(value(generator));
+    return result;
+}
+
+//! Every eighth input is malformed
+std::vector<std::string> Mixed()
+{
+    std::vector<std::string> result = Integers();
+    for (std::size_t i = 0; i < result.size(); i += 8)
+        result[i] += "x";
+    return result;
+}
+
+//! Sums a whole batch per iteration, so the loop body is just the parse
+template<typename T>
+void Parse(benchmark::State& state, const std::vector<std::string>& values)
+{
+    for (auto _ : state)
+    {
+        T sum = T();
+        for (const std::string& value : values)
+            sum += conv::cast<T>(value);
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+template<typename T>
+void ParseOrDefault(benchmark::State& state, const std::vector<std::string>& values)
+{
+    for (auto _ : state)
+    {
+        T sum = T();
+        for (const std::string& value : values)
+            sum += conv::cast<T>(value, T());
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+void ParseInt(benchmark::State& state) { Parse<int>(state, Integers()); }
+void ParseDouble(benchmark::State& state) { Parse<double>(state, Doubles()); }
+void ParseIntOrDefault(benchmark::State& state) { ParseOrDefault<int>(state, Mixed()); }
+void ParseDoubleOrDefault(benchmark::State& state) { ParseOrDefault<double>(state, Mixed()); }
+
+} // namespace
+
+BENCHMARK(ParseInt);
+BENCHMARK(ParseDouble);
+BENCHMARK(ParseIntOrDefault);
+BENCHMARK(ParseDoubleOrDefault);
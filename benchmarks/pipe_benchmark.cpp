@@ -0,0 +1,72 @@
+#include "conversion/cast.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <string>
+
+namespace
+{
+
+//! Megabyte of cp1251 text, words of Cyrillic letters between spaces
+const std::string& Text()
+{
+    static const std::string text = []
+    {
+        std::mt19937 generator(42);
+        std::string result(1 << 20, ' ');
+        for (char& c : result)
+        {
+            if (generator() % 8)
+                c = static_cast<char>(0xC0 + generator() % 64);
+        }
+        return result;
+    }();
+    return text;
+}
+
+const std::string& Encoded()
+{
+    static const std::string encoded = conv::cast<conv::Base64>(conv::cast<std::string, conv::Ansi>(Text()));
+    return encoded;
+}
+
+void Run(benchmark::State& state, const std::string& src)
+{
+    state.SetBytesProcessed(static_cast<boost::int64_t>(state.iterations() * src.size()));
+}
+
+void Chained(benchmark::State& state)
+{
+    for (auto _ : state)
+        benchmark::DoNotOptimize(conv::cast<conv::Base64>(conv::cast<std::string, conv::Ansi>(Text())));
+    Run(state, Text());
+}
+
+void Piped(benchmark::State& state)
+{
+    for (auto _ : state)
+        benchmark::DoNotOptimize(conv::pipe<conv::Ansi, std::string, conv::Base64>(Text(), static_cast<std::size_t>(state.range(0))));
+    Run(state, Text());
+}
+
+void ChainedDecode(benchmark::State& state)
+{
+    for (auto _ : state)
+        benchmark::DoNotOptimize(conv::cast<std::wstring>(conv::cast<std::string, conv::Base64>(Encoded())));
+    Run(state, Encoded());
+}
+
+void PipedDecode(benchmark::State& state)
+{
+    for (auto _ : state)
+        benchmark::DoNotOptimize(conv::pipe<conv::Base64, std::string, std::wstring>(Encoded(), static_cast<std::size_t>(state.range(0))));
+    Run(state, Encoded());
+}
+
+} // namespace
+
+BENCHMARK(Chained);
+BENCHMARK(Piped)->Arg(1024)->Arg(4096)->Arg(65536);
+BENCHMARK(ChainedDecode);
+BENCHMARK(PipedDecode)->Arg(1024)->Arg(4096)->Arg(65536);
@@ -0,0 +1,83 @@
+//! Time to the first conversion in a fresh process, which includes charset resolution and converter setup.
+//! Without arguments every conversion is measured in a series of child processes, with a conversion name only that one is run once.
+
+#include "conversion/text.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#define popen _popen
+#define pclose _pclose
+#endif
+
+namespace
+{
+
+const char* const g_Conversions[] = {"utf8", "wide", "ansi", "ansi_wide", "wide_ansi"};
+const unsigned g_Runs = 20;
+
+void Convert(const std::string& name)
+{
+    const std::wstring wide = L"\x041F\x0440\x0438\x0432\x0435\x0442";
+    const std::string ansi = "\xCF\xF0\xE8\xE2\xE5\xF2";
+
+    if (name == "utf8")
+        conv::cast<std::string>(wide);
+    else if (name == "wide")
+        conv::cast<std::wstring>(std::string("\xD0\x9F\xD1\x80\xD0\xB8"));
+    else if (name == "ansi")
+        conv::cast<std::string, conv::Ansi>(ansi);
+    else if (name == "ansi_wide")
+        conv::cast<std::wstring, conv::Ansi>(ansi);
+    else if (name == "wide_ansi")
+        conv::cast<conv::Ansi>(wide);
+}
+
+int RunChild(const std::string& name)
+{
+    const auto start = std::chrono::steady_clock::now();
+    Convert(name);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    std::cout << std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count() << std::endl;
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc > 1)
+        return RunChild(argv[1]);
+
+    std::printf("%-12s %12s %12s %12s\n", "conversion", "min us", "median us", "max us");
+    for (const char* name : g_Conversions)
+    {
+        std::vector<long> samples;
+        for (unsigned i = 0; i < g_Runs; ++i)
+        {
+            const std::string command = std::string("\"") + argv[0] + "\" " + name;
+            FILE* const pipe = popen(command.c_str(), "r");
+            if (!pipe)
+                return 1;
+
+            long micros = 0;
+            const int parsed = std::fscanf(pipe, "%ld", &micros);
+            if (pclose(pipe) || parsed != 1)
+                return 1;
+
+            samples.push_back(micros);
+        }
+
+        std::sort(samples.begin(), samples.end());
+        std::printf("%-12s %12ld %12ld %12ld\n", name, samples.front(), samples[samples.size() / 2], samples.back());
+    }
+
+    return 0;
+}
@@ -0,0 +1,177 @@
+#include "conversion/cast.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+enum class Color { Red, Green, Blue };
+
+//! Runs the same conversion on every benchmark thread, throughput should grow linearly with the thread count
+template<typename Target, typename Source>
+void Scaling(benchmark::State& state, const Source& src)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(conv::cast<Target>(src));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+//! Same for the tagged sources
+template<typename Target, typename From>
+void ScalingFrom(benchmark::State& state, const typename conv::details::TypeTraits<From>::Type& src)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(conv::cast<Target, From>(src));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+const boost::posix_time::ptime g_Time(boost::gregorian::date(2014, 10, 15), boost::posix_time::time_duration(17, 41, 52, 724658));
+
+void IntToString(benchmark::State& state) { Scaling<std::string>(state, 1234567); }
+void StringToInt(benchmark::State& state) { Scaling<int>(state, std::string("1234567")); }
+void Uint64ToString(benchmark::State& state) { Scaling<std::string>(state, boost::uint64_t(1234567890123456789ull)); }
+void IntToWstring(benchmark::State& state) { Scaling<std::wstring>(state, -42); }
+void DoubleToString(benchmark::State& state) { Scaling<std::string>(state, 0.1234567); }
+void StringToDouble(benchmark::State& state) { Scaling<double>(state, std::string("0.1234567")); }
+void Numeric(benchmark::State& state) { Scaling<short>(state, 12345); }
+void EnumToString(benchmark::State& state) { Scaling<std::string>(state, Color::Blue); }
+void StringToEnum(benchmark::State& state) { Scaling<Color>(state, std::string("2")); }
+void BoolToString(benchmark::State& state) { Scaling<std::string>(state, true); }
+void StringToBool(benchmark::State& state) { Scaling<bool>(state, std::string("true")); }
+void ByteToString(benchmark::State& state) { Scaling<std::string>(state, static_cast<unsigned char>(200)); }
+void StringToByte(benchmark::State& state) { Scaling<unsigned char>(state, std::string("200")); }
+void Bits(benchmark::State& state) { Scaling<std::vector<unsigned>>(state, 0xF0F0F0F0u); }
+void FromBits(benchmark::State& state) { Scaling<unsigned>(state, std::vector<unsigned>{ 4, 5, 6, 7, 12, 13, 14, 15 }); }
+
+const std::string g_Utf8 = "\xd0\x9f\xd1\x80\xd0\xb8\xd0\xb2\xd0\xb5\xd1\x82, world";
+const std::wstring g_Wide = L"\x041f\x0440\x0438\x0432\x0435\x0442, world";
+const std::string g_Cp1251 = "\xcf\xf0\xe8\xe2\xe5\xf2, world";
+
+void Utf8ToWide(benchmark::State& state) { Scaling<std::wstring>(state, g_Utf8); }
+void WideToUtf8(benchmark::State& state) { Scaling<std::string>(state, g_Wide); }
+void Utf8PointerToWide(benchmark::State& state) { Scaling<std::wstring>(state, g_Utf8.c_str()); }
+void WidePointerToUtf8(benchmark::State& state) { Scaling<std::string>(state, g_Wide.c_str()); }
+void AnsiToUtf8(benchmark::State& state) { ScalingFrom<std::string, conv::Ansi>(state, g_Cp1251); }
+void AnsiToWide(benchmark::State& state) { ScalingFrom<std::wstring, conv::Ansi>(state, g_Cp1251); }
+void WideToAnsi(benchmark::State& state) { Scaling<conv::Ansi>(state, g_Wide); }
+
+void Stream(benchmark::State& state)
+{
+    std::stringstream stream("stream contents");
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(conv::cast<std::string>(stream));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void TimeToUint64(benchmark::State& state) { Scaling<boost::uint64_t>(state, g_Time); }
+void TimeToUint32(benchmark::State& state) { Scaling<boost::uint32_t>(state, g_Time); }
+void Uint64ToTime(benchmark::State& state) { Scaling<boost::posix_time::ptime>(state, boost::uint64_t(1413394912724ull)); }
+void Uint32ToTime(benchmark::State& state) { Scaling<boost::posix_time::ptime>(state, boost::uint32_t(1413394912u)); }
+void TimeToString(benchmark::State& state) { Scaling<std::string>(state, g_Time); }
+void StringToTime(benchmark::State& state) { Scaling<boost::posix_time::ptime>(state, std::string("2014-10-15T17:41:52.724658")); }
+void OffsetStringToTime(benchmark::State& state) { Scaling<boost::posix_time::ptime>(state, std::string("2014-10-15T20:41:52.724658123+03:00")); }
+void StrictStringToTime(benchmark::State& state) { Scaling<conv::StrictTime>(state, std::string("2014-10-15T17:41:52.724658")); }
+
+struct Berlin { static const char* Name() { return "Europe/Berlin"; } };
+void TimeDurationToString(benchmark::State& state) { Scaling<std::string>(state, g_Time.time_of_day()); }
+void StringToTimeDuration(benchmark::State& state) { Scaling<boost::posix_time::time_duration>(state, std::string("17:41:52.724658")); }
+void DateToString(benchmark::State& state) { Scaling<std::string>(state, g_Time.date()); }
+void StringToDate(benchmark::State& state) { Scaling<boost::gregorian::date>(state, std::string("2014-10-15")); }
+void TimeToLocal(benchmark::State& state) { Scaling<conv::LocalTime<Berlin> >(state, g_Time); }
+
+typedef std::chrono::time_point<std::chrono::system_clock, std::chrono::microseconds> ChronoTime;
+
+void ChronoToString(benchmark::State& state) { Scaling<std::string>(state, ChronoTime(std::chrono::microseconds(1413394912724658))); }
+void StringToChrono(benchmark::State& state) { Scaling<ChronoTime>(state, std::string("2014-10-15T17:41:52.724658")); }
+void DurationToString(benchmark::State& state) { Scaling<std::string>(state, std::chrono::microseconds(63712724658)); }
+void StringToDuration(benchmark::State& state) { Scaling<std::chrono::microseconds>(state, std::string("17:41:52.724658")); }
+
+const std::string g_Binary = "binary data for base64 and hex conversions";
+
+void ToBase64(benchmark::State& state) { Scaling<conv::Base64>(state, g_Binary); }
+void FromBase64(benchmark::State& state) { ScalingFrom<std::string, conv::Base64>(state, conv::cast<conv::Base64>(g_Binary)); }
+void ToHex(benchmark::State& state) { Scaling<conv::Hex>(state, std::vector<char>(g_Binary.begin(), g_Binary.end())); }
+void FromHex(benchmark::State& state) { ScalingFrom<std::vector<char>, conv::Hex>(state, conv::cast<conv::Hex>(std::vector<char>(g_Binary.begin(), g_Binary.end()))); }
+void BinaryToString(benchmark::State& state) { Scaling<std::string>(state, std::vector<char>(g_Binary.begin(), g_Binary.end())); }
+void StringToBinary(benchmark::State& state) { Scaling<std::vector<char>>(state, conv::cast<std::string>(std::vector<char>(g_Binary.begin(), g_Binary.end()))); }
+void BytesToString(benchmark::State& state) { Scaling<std::string>(state, std::vector<unsigned char>(g_Binary.begin(), g_Binary.end())); }
+void StringToBytes(benchmark::State& state) { Scaling<std::vector<unsigned char>>(state, conv::cast<std::string>(std::vector<unsigned char>(g_Binary.begin(), g_Binary.end()))); }
+
+void NumberList(benchmark::State& state) { Scaling<std::vector<boost::uint64_t>>(state, std::string("1,22,333,4444,55555")); }
+void FromNumberList(benchmark::State& state) { Scaling<std::string>(state, std::vector<boost::uint64_t>{ 1, 22, 333, 4444, 55555 }); }
+void StringList(benchmark::State& state) { Scaling<std::vector<std::string>>(state, std::string("one,two,three,four")); }
+void FromStringList(benchmark::State& state) { Scaling<std::string>(state, std::vector<std::string>{ "one", "two", "three", "four" }); }
+
+const int g_MaxThreads = std::max(1u, std::thread::hardware_concurrency());
+
+} // namespace
+
+#define THREADS_BENCHMARK(name) BENCHMARK(name)->ThreadRange(1, g_MaxThreads)->UseRealTime()
+
+THREADS_BENCHMARK(IntToString);
+THREADS_BENCHMARK(StringToInt);
+THREADS_BENCHMARK(Uint64ToString);
+THREADS_BENCHMARK(IntToWstring);
+THREADS_BENCHMARK(DoubleToString);
+THREADS_BENCHMARK(StringToDouble);
+THREADS_BENCHMARK(Numeric);
+THREADS_BENCHMARK(EnumToString);
+THREADS_BENCHMARK(StringToEnum);
+THREADS_BENCHMARK(BoolToString);
+THREADS_BENCHMARK(StringToBool);
+THREADS_BENCHMARK(ByteToString);
+THREADS_BENCHMARK(StringToByte);
+THREADS_BENCHMARK(Bits);
+THREADS_BENCHMARK(FromBits);
+THREADS_BENCHMARK(Utf8ToWide);
+THREADS_BENCHMARK(WideToUtf8);
+THREADS_BENCHMARK(Utf8PointerToWide);
+THREADS_BENCHMARK(WidePointerToUtf8);
+THREADS_BENCHMARK(AnsiToUtf8);
+THREADS_BENCHMARK(AnsiToWide);
+THREADS_BENCHMARK(WideToAnsi);
+THREADS_BENCHMARK(Stream);
+THREADS_BENCHMARK(TimeToUint64);
+THREADS_BENCHMARK(TimeToUint32);
+THREADS_BENCHMARK(Uint64ToTime);
+THREADS_BENCHMARK(Uint32ToTime);
+THREADS_BENCHMARK(TimeToString);
+THREADS_BENCHMARK(StringToTime);
+THREADS_BENCHMARK(OffsetStringToTime);
+THREADS_BENCHMARK(StrictStringToTime);
+THREADS_BENCHMARK(TimeDurationToString);
+THREADS_BENCHMARK(StringToTimeDuration);
+THREADS_BENCHMARK(DateToString);
+THREADS_BENCHMARK(StringToDate);
+THREADS_BENCHMARK(TimeToLocal);
+THREADS_BENCHMARK(ChronoToString);
+THREADS_BENCHMARK(StringToChrono);
+THREADS_BENCHMARK(DurationToString);
+THREADS_BENCHMARK(StringToDuration);
+THREADS_BENCHMARK(ToBase64);
+THREADS_BENCHMARK(FromBase64);
+THREADS_BENCHMARK(ToHex);
+THREADS_BENCHMARK(FromHex);
+THREADS_BENCHMARK(BinaryToString);
+THREADS_BENCHMARK(StringToBinary);
+THREADS_BENCHMARK(BytesToString);
+THREADS_BENCHMARK(StringToBytes);
+THREADS_BENCHMARK(NumberList);
+THREADS_BENCHMARK(FromNumberList);
+THREADS_BENCHMARK(StringList);
+THREADS_BENCHMARK(FromStringList);
@@ -0,0 +1,153 @@
+#include "conversion/cast.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+const std::size_t g_Lines = 100000;
+
+//! Timestamps of a busy log, a few milliseconds apart with bursts and pauses, crossing several hours
+std::vector<std::string> LogCorpus(const std::string& suffix)
+{
+    std::mt19937 generator(42);
+    std::exponential_distribution<double> gap(1.0 / 5000);
+
+    boost::posix_time::ptime time(boost::gregorian::date(2014, 10, 15), boost::posix_time::time_duration(17, 41, 52, 724658));
+    std::vector<std::string> result;
+    result.reserve(g_Lines);
+    for (std::size_t i = 0; i < g_Lines; ++i)
+    {
+        time += boost::posix_time::microseconds(static_cast<boost::int64_t>(gap(generator)) * (i % 1000 ? 1 : 20000));
+        result.push_back(conv::cast<std::string>(time) + suffix);
+    }
+    return result;
+}
+
+template<typename T, typename Parse>
+void Run(benchmark::State& state, const std::vector<T>& lines, Parse parse)
+{
+    std::size_t index = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(parse(lines[index]));
+        if (++index == lines.size())
+            index = 0;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+const std::vector<std::string>& Utc()
+{
+    static const std::vector<std::string> lines = LogCorpus("Z");
+    return lines;
+}
+
+const std::vector<std::string>& Offset()
+{
+    static const std::vector<std::string> lines = LogCorpus("+03:00");
+    return lines;
+}
+
+//! Same timestamps as epoch milliseconds, and a column where every third one comes from each kind of producer
+const std::vector<std::string>& Milliseconds()
+{
+    static const std::vector<std::string> lines = []
+    {
+        std::vector<std::string> result;
+        for (const std::string& line : Utc())
+            result.push_back(conv::cast<std::string>(conv::cast<boost::uint64_t>(conv::cast<boost::posix_time::ptime>(line))));
+        return result;
+    }();
+    return lines;
+}
+
+const std::vector<std::string>& Mixed()
+{
+    static const std::vector<std::string> lines = []
+    {
+        std::vector<std::string> result;
+        for (std::size_t i = 0; i < g_Lines; ++i)
+            result.push_back(i % 3 == 0 ? Utc()[i] : i % 3 == 1 ? Milliseconds()[i] : Milliseconds()[i].substr(0, 10));
+        return result;
+    }();
+    return lines;
+}
+
+//! Column at once, items are timestamps
+void RunBatch(benchmark::State& state, const std::vector<std::string>& lines)
+{
+    std::vector<boost::posix_time::ptime> out(lines.size());
+    for (auto _ : state)
+    {
+        conv::cast<boost::posix_time::ptime, conv::AnyTimestamp>(lines.data(), lines.data() + lines.size(), out.data());
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * lines.size());
+}
+
+void Cast(benchmark::State& state) { Run(state, Utc(), [](const std::string& line) { return conv::cast<boost::posix_time::ptime>(line); }); }
+void Parser(benchmark::State& state) { conv::TimestampParser parser; Run(state, Utc(), [&](const std::string& line) { return parser(line); }); }
+void Strict(benchmark::State& state) { Run(state, Utc(), [](const std::string& line) { return conv::cast<conv::StrictTime>(line); }); }
+void CastOffset(benchmark::State& state) { Run(state, Offset(), [](const std::string& line) { return conv::cast<boost::posix_time::ptime>(line); }); }
+void ParserOffset(benchmark::State& state) { conv::TimestampParser parser; Run(state, Offset(), [&](const std::string& line) { return parser(line); }); }
+void AnyText(benchmark::State& state) { Run(state, Utc(), [](const std::string& line) { return conv::cast<boost::posix_time::ptime, conv::AnyTimestamp>(line); }); }
+void AnyMilliseconds(benchmark::State& state) { Run(state, Milliseconds(), [](const std::string& line) { return conv::cast<boost::posix_time::ptime, conv::AnyTimestamp>(line); }); }
+void AnyMixed(benchmark::State& state) { Run(state, Mixed(), [](const std::string& line) { return conv::cast<boost::posix_time::ptime, conv::AnyTimestamp>(line); }); }
+void BatchAnyText(benchmark::State& state) { RunBatch(state, Utc()); }
+void BatchAnyMixed(benchmark::State& state) { RunBatch(state, Mixed()); }
+
+//! Timestamps of the log to write back, with microseconds so the text is past the small string buffer
+const std::vector<boost::posix_time::ptime>& Times()
+{
+    static const std::vector<boost::posix_time::ptime> times = []
+    {
+        std::vector<boost::posix_time::ptime> result;
+        for (const std::string& line : Utc())
+            result.push_back(conv::cast<boost::posix_time::ptime>(line));
+        return result;
+    }();
+    return times;
+}
+
+void Format(benchmark::State& state) { Run(state, Times(), [](const boost::posix_time::ptime& time) { return conv::cast<std::string>(time); }); }
+void FormatInline(benchmark::State& state) { Run(state, Times(), [](const boost::posix_time::ptime& time) { return conv::cast<conv::Inline<boost::posix_time::ptime> >(time); }); }
+
+//! Number first, then the text on the exception, as callers did before AnyTimestamp
+void TryEachMixed(benchmark::State& state)
+{
+    Run(state, Mixed(), [](const std::string& line)
+    {
+        try
+        {
+            const boost::uint64_t count = conv::cast<boost::uint64_t>(line);
+            return line.size() <= 10 ? conv::cast<boost::posix_time::ptime>(static_cast<boost::uint32_t>(count)) : conv::cast<boost::posix_time::ptime>(count);
+        }
+        catch (const conv::CastException&)
+        {
+            return conv::cast<boost::posix_time::ptime>(line);
+        }
+    });
+}
+
+} // namespace
+
+BENCHMARK(Cast);
+BENCHMARK(Parser);
+BENCHMARK(Strict);
+BENCHMARK(CastOffset);
+BENCHMARK(ParserOffset);
+BENCHMARK(AnyText);
+BENCHMARK(AnyMilliseconds);
+BENCHMARK(AnyMixed);
+BENCHMARK(BatchAnyText);
+BENCHMARK(BatchAnyMixed);
+BENCHMARK(TryEachMixed);
+BENCHMARK(Format);
+BENCHMARK(FormatInline);
@@ -0,0 +1,105 @@
+#include "conversion/cast.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <istream>
+#include <ostream>
+#include <string>
+
+namespace streamed
+{
+
+//! Money amount that converts through its stream operators, as user types did before the customization points
+struct Amount
+{
+    long long m_Cents;
+};
+
+std::ostream& operator << (std::ostream& out, const Amount& amount)
+{
+    return out << amount.m_Cents / 100 << '.' << amount.m_Cents % 100 / 10 << amount.m_Cents % 10;
+}
+
+std::istream& operator >> (std::istream& in, Amount& amount)
+{
+    long long units = 0;
+    char dot = 0;
+    unsigned cents = 0;
+    in >> units >> dot >> cents;
+    if (dot != '.')
+        in.setstate(std::ios_base::failbit);
+    amount.m_Cents = units * 100 + cents;
+    return in;
+}
+
+} // namespace streamed
+
+namespace customized
+{
+
+//! The same amount with conv_to_chars and conv_from_chars
+struct Amount
+{
+    long long m_Cents;
+};
+
+void conv_to_chars(std::string& buffer, const Amount& amount)
+{
+    buffer += conv::cast<std::string>(amount.m_Cents / 100);
+    buffer += '.';
+    buffer += static_cast<char>('0' + amount.m_Cents % 100 / 10);
+    buffer += static_cast<char>('0' + amount.m_Cents % 10);
+}
+
+bool conv_from_chars(const char* first, const char* last, Amount& amount)
+{
+    const char* const dot = std::find(first, last, '.');
+    if (last - dot != 3)
+        return false;
+    long long units = 0;
+    unsigned cents = 0;
+    if (!conv::details::integer::Parse(first, dot, units) || !conv::details::integer::Parse(dot + 1, last, cents))
+        return false;
+    amount.m_Cents = units * 100 + cents;
+    return true;
+}
+
+} // namespace customized
+
+namespace
+{
+
+template<typename Amount>
+void Format(benchmark::State& state)
+{
+    long long cents = 1234567;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(conv::cast<std::string>(Amount{ cents++ }));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<typename Amount>
+void Parse(benchmark::State& state)
+{
+    const std::string text = "12345.67";
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(conv::cast<Amount>(text));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void FormatStreamed(benchmark::State& state) { Format<streamed::Amount>(state); }
+void FormatCustomized(benchmark::State& state) { Format<customized::Amount>(state); }
+void ParseStreamed(benchmark::State& state) { Parse<streamed::Amount>(state); }
+void ParseCustomized(benchmark::State& state) { Parse<customized::Amount>(state); }
+
+} // namespace
+
+BENCHMARK(FormatStreamed);
+BENCHMARK(FormatCustomized);
+BENCHMARK(ParseStreamed);
+BENCHMARK(ParseCustomized);
@@ -0,0 +1,89 @@
+#include "differential.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+
+namespace
+{
+
+//! Generated inputs per check, in addition to the corpus
+const int g_Generated = 2000;
+
+//! Characters the conversions treat specially, generated payloads are biased towards them
+const char g_Interesting[] = "0123456789+-.,eEZT:xX=/_ \tABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz\xd0\xd1\x80\xbf\xc0\xff";
+
+std::string Generate(std::mt19937& generator)
+{
+    std::uniform_int_distribution<int> length(0, 40);
+    std::uniform_int_distribution<int> kind(0, 3);
+    std::uniform_int_distribution<int> byte(0, 255);
+    std::uniform_int_distribution<std::size_t> interesting(0, sizeof(g_Interesting) - 2);
+
+    std::string result(length(generator), '\0');
+    for (char& c : result)
+        c = kind(generator) ? g_Interesting[interesting(generator)] : static_cast<char>(byte(generator));
+    return result;
+}
+
+bool Report(const fuzz::Mismatch& e, int& failures)
+{
+    std::cerr << e.what() << std::endl;
+    return ++failures < 100;
+}
+
+} // namespace
+
+//! Replays the corpus files given on the command line and a fixed set of generated inputs through every check
+int main(int argc, char** argv)
+{
+    int failures = 0;
+    int inputs = 0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::ifstream file(argv[i], std::ios::binary);
+        if (!file)
+        {
+            std::cerr << "cannot open " << argv[i] << std::endl;
+            return 2;
+        }
+
+        const std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        try
+        {
+            ++inputs;
+            fuzz::Run(reinterpret_cast<const unsigned char*>(data.data()), data.size());
+        }
+        catch (const fuzz::Mismatch& e)
+        {
+            std::cerr << argv[i] << ": ";
+            if (!Report(e, failures))
+                return 1;
+        }
+    }
+
+    std::mt19937 generator(20141015);
+    for (std::size_t check = 0; check < fuzz::CheckCount(); ++check)
+    {
+        for (int i = 0; i < g_Generated; ++i)
+        {
+            try
+            {
+                ++inputs;
+                fuzz::RunCheck(check, Generate(generator));
+            }
+            catch (const fuzz::Mismatch& e)
+            {
+                if (!Report(e, failures))
+                    return 1;
+            }
+        }
+    }
+
+    std::cout << inputs << " inputs, " << failures << " mismatches" << std::endl;
+    return failures ? 1 : 0;
+}
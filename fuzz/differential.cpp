@@ -0,0 +1,1070 @@
+#include "differential.hpp"
+
+#include "conversion/cast.hpp"
+#include "conversion/details/utf.hpp"
+
+#include "stlencoders/base2.hpp"
+#include "stlencoders/base16.hpp"
+#include "stlencoders/base32.hpp"
+#include "stlencoders/base64.hpp"
+
+#include <boost/algorithm/hex.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <boost/locale/encoding.hpp>
+#include <boost/locale/encoding_utf.hpp>
+#include <boost/numeric/conversion/cast.hpp>
+
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <regex>
+#include <sstream>
+#include <type_traits>
+#include <vector>
+
+namespace fuzz
+{
+namespace
+{
+
+//! Error class of a conversion, exception types of both paths are mapped onto it
+enum class Error { None, Cast, InvalidCharacter, InvalidLength, Other };
+
+const char* ErrorName(const Error error)
+{
+    switch (error)
+    {
+    case Error::None: return "ok";
+    case Error::Cast: return "cast error";
+    case Error::InvalidCharacter: return "invalid character";
+    case Error::InvalidLength: return "invalid length";
+    default: return "other error";
+    }
+}
+
+//! Printable form of conversion results, equal values give equal strings
+std::string Canonical(const std::string& value)
+{
+    std::string result;
+    for (const char c : value)
+    {
+        if (std::isprint(static_cast<unsigned char>(c)) && c != '\\')
+        {
+            result.push_back(c);
+        }
+        else
+        {
+            char buffer[8];
+            std::snprintf(buffer, sizeof(buffer), "\\x%02x", static_cast<unsigned char>(c));
+            result += buffer;
+        }
+    }
+    return result;
+}
+
+std::string Canonical(const std::wstring& value)
+{
+    std::string result;
+    for (const wchar_t c : value)
+    {
+        char buffer[16];
+        std::snprintf(buffer, sizeof(buffer), "\\u{%x}", static_cast<unsigned>(c));
+        result += buffer;
+    }
+    return result;
+}
+
+std::string Canonical(const bool value)
+{
+    return value ? "true" : "false";
+}
+
+template<typename T>
+typename std::enable_if<std::is_integral<T>::value, std::string>::type Canonical(const T value)
+{
+    return std::to_string(value);
+}
+
+template<typename T>
+typename std::enable_if<std::is_floating_point<T>::value, std::string>::type Canonical(const T value)
+{
+    char buffer[64];
+    std::snprintf(buffer, sizeof(buffer), "%a", static_cast<double>(value));
+    return buffer;
+}
+
+//! Strings in arena memory print as their standard counterparts
+template<typename Char>
+std::string Canonical(const std::basic_string<Char, std::char_traits<Char>, conv::Allocator<Char> >& value)
+{
+    return Canonical(std::basic_string<Char>(value.begin(), value.end()));
+}
+
+template<typename T, typename Alloc>
+std::string Canonical(const std::vector<T, Alloc>& value)
+{
+    std::string result;
+    for (const T& item : value)
+        result += Canonical(item) + ';';
+    return result;
+}
+
+std::string Canonical(const boost::posix_time::ptime& value)
+{
+    return boost::posix_time::to_simple_string(value);
+}
+
+std::string Canonical(const boost::posix_time::time_duration& value)
+{
+    return boost::posix_time::to_simple_string(value);
+}
+
+std::string Canonical(const boost::gregorian::date& value)
+{
+    return boost::gregorian::to_simple_string(value);
+}
+
+struct Outcome
+{
+    Error m_Error;
+    std::string m_Value;
+};
+
+template<typename Function>
+Outcome Evaluate(Function function)
+{
+    try
+    {
+        return Outcome{ Error::None, Canonical(function()) };
+    }
+    catch (const conv::CastException&)
+    {
+        return Outcome{ Error::Cast, std::string() };
+    }
+    catch (const boost::bad_lexical_cast&)
+    {
+        return Outcome{ Error::Cast, std::string() };
+    }
+    catch (const boost::numeric::bad_numeric_cast&)
+    {
+        return Outcome{ Error::Cast, std::string() };
+    }
+    catch (const stlencoders::invalid_character&)
+    {
+        return Outcome{ Error::InvalidCharacter, std::string() };
+    }
+    catch (const stlencoders::invalid_length&)
+    {
+        return Outcome{ Error::InvalidLength, std::string() };
+    }
+    catch (const boost::algorithm::non_hex_input&)
+    {
+        return Outcome{ Error::InvalidCharacter, std::string() };
+    }
+    catch (const boost::algorithm::not_enough_input&)
+    {
+        return Outcome{ Error::InvalidLength, std::string() };
+    }
+    catch (const std::exception&)
+    {
+        return Outcome{ Error::Other, std::string() };
+    }
+}
+
+std::string Describe(const Outcome& outcome)
+{
+    return outcome.m_Error == Error::None ? '"' + outcome.m_Value + '"' : ErrorName(outcome.m_Error);
+}
+
+//! Runs both paths on the same input, output and error class must be the same
+template<typename Fast, typename Reference>
+void Compare(const std::string& name, const std::string& payload, Fast fast, Reference reference)
+{
+    const Outcome expected = Evaluate(reference);
+    const Outcome actual = Evaluate(fast);
+    if (actual.m_Error != expected.m_Error || actual.m_Value != expected.m_Value)
+        throw Mismatch(name + " on \"" + Canonical(payload) + "\": fast path " + Describe(actual) + ", reference " + Describe(expected));
+}
+
+//! Value built from the leading payload bytes, zero padded
+template<typename T>
+T Bits(const std::string& payload)
+{
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type storage = {};
+    std::memcpy(&storage, payload.data(), std::min(payload.size(), sizeof(T)));
+    T result;
+    std::memcpy(&result, &storage, sizeof(T));
+    return result;
+}
+
+//! Wide string with one code unit per two or three payload bytes, mostly valid code points
+std::wstring Wide(const std::string& payload)
+{
+    const std::size_t step = sizeof(wchar_t) == 2 ? 2 : 3;
+
+    std::wstring result;
+    for (std::size_t i = 0; i + step <= payload.size(); i += step)
+    {
+        boost::uint32_t unit = 0;
+        for (std::size_t j = 0; j < step; ++j)
+            unit |= static_cast<boost::uint32_t>(static_cast<unsigned char>(payload[i + j])) << (8 * j);
+        result.push_back(static_cast<wchar_t>(step == 2 ? unit : unit % 0x110000));
+    }
+    return result;
+}
+
+template<typename T>
+void ParseInteger(const std::string& name, const std::string& payload)
+{
+    Compare(name, payload, [&] { return conv::cast<T>(payload); }, [&] { return boost::lexical_cast<T>(payload); });
+
+    const std::wstring wide(payload.begin(), payload.end());
+    Compare(name + " wide", payload, [&] { return conv::cast<T>(wide); }, [&] { return boost::lexical_cast<T>(wide); });
+}
+
+template<typename T>
+void FormatInteger(const std::string& name, const std::string& payload)
+{
+    const T value = Bits<T>(payload);
+    Compare(name, payload, [&] { return conv::cast<std::string>(value); }, [&] { return boost::lexical_cast<std::string>(value); });
+    Compare(name + " wide", payload, [&] { return conv::cast<std::wstring>(value); }, [&] { return boost::lexical_cast<std::wstring>(value); });
+}
+
+template<typename T>
+void ParseFloat(const std::string& name, const std::string& payload)
+{
+    Compare(name, payload, [&] { return conv::cast<T>(payload); }, [&] { return boost::lexical_cast<T>(payload); });
+}
+
+//! Shortest form must read back to the same value and be no longer than the max_digits10 form
+template<typename T>
+void FormatFloat(const std::string& name, const std::string& payload)
+{
+    const T value = Bits<T>(payload);
+    const std::string reference = boost::lexical_cast<std::string>(value);
+
+#ifdef CONVERSION_FLOAT_MAX_DIGITS10
+    Compare(name, payload, [&] { return conv::cast<std::string>(value); }, [&] { return reference; });
+#else
+    const std::string fast = conv::cast<std::string>(value);
+    const T back = boost::lexical_cast<T>(fast);
+
+    const bool same = std::isnan(value) ? std::isnan(back) : back == value && std::signbit(back) == std::signbit(value);
+    if (!same || fast.size() > reference.size())
+        throw Mismatch(name + " on " + Canonical(value) + ": fast path \"" + fast + "\", reference \"" + reference + '"');
+#endif
+}
+
+void ParseBool(const std::string& name, const std::string& payload)
+{
+    Compare(name, payload, [&] { return conv::cast<bool>(payload); }, [&] { return static_cast<bool>(boost::lexical_cast<conv::details::Boolean>(payload)); });
+}
+
+//! Checked narrowing as numeric_cast, additionally rejecting fractions and passing infinities through
+template<typename Target, typename Source>
+Target ReferenceNarrow(const Source value)
+{
+    if (std::is_integral<Target>::value && std::is_floating_point<Source>::value && std::trunc(value) != value)
+        throw boost::numeric::bad_numeric_cast();
+    if (std::is_floating_point<Target>::value && std::is_floating_point<Source>::value && std::isinf(value))
+        return static_cast<Target>(value);
+    return boost::numeric_cast<Target>(value);
+}
+
+template<typename Target, typename Source>
+void Narrow(const std::string& name, const std::string& payload)
+{
+    const Source value = Bits<Source>(payload);
+    Compare(name, payload, [&] { return conv::cast<Target>(value); }, [&] { return ReferenceNarrow<Target>(value); });
+}
+
+void Utf8ToWide(const std::string& name, const std::string& payload)
+{
+    const auto reference = [&] { return boost::locale::conv::utf_to_utf<wchar_t>(payload); };
+    Compare(name, payload, [&] { return conv::cast<std::wstring>(payload); }, reference);
+    Compare(name + " built-in", payload, [&] { std::wstring result; conv::details::utf::Utf8ToWide(payload.begin(), payload.end(), result); return result; }, reference);
+}
+
+void WideToUtf8(const std::string& name, const std::string& payload)
+{
+    const std::wstring wide = Wide(payload);
+    const auto reference = [&] { return boost::locale::conv::utf_to_utf<char>(wide); };
+    Compare(name, payload, [&] { return conv::cast<std::string>(wide); }, reference);
+    Compare(name + " built-in", payload, [&] { std::string result; conv::details::utf::WideToUtf8(wide.begin(), wide.end(), result); return result; }, reference);
+}
+
+void AnsiToUtf8(const std::string& name, const std::string& payload)
+{
+    const auto reference = [&] { return boost::locale::conv::to_utf<char>(payload, "cp1251"); };
+    Compare(name, payload, [&] { return conv::cast<std::string, conv::Ansi>(payload); }, reference);
+    Compare(name + " built-in", payload, [&] { std::string result; conv::details::utf::Cp1251ToUtf8(payload.begin(), payload.end(), result); return result; }, reference);
+}
+
+void AnsiToWide(const std::string& name, const std::string& payload)
+{
+    const auto reference = [&] { return boost::locale::conv::to_utf<wchar_t>(payload, "cp1251"); };
+    Compare(name, payload, [&] { return conv::cast<std::wstring, conv::Ansi>(payload); }, reference);
+    Compare(name + " built-in", payload, [&] { std::wstring result; conv::details::utf::Cp1251ToWide(payload.begin(), payload.end(), result); return result; }, reference);
+}
+
+void WideToAnsi(const std::string& name, const std::string& payload)
+{
+    const std::wstring wide = Wide(payload);
+    const auto reference = [&] { return boost::locale::conv::from_utf(wide, "cp1251"); };
+    Compare(name, payload, [&] { return conv::cast<conv::Ansi>(wide); }, reference);
+    Compare(name + " built-in", payload, [&] { std::string result; conv::details::utf::WideToCp1251(wide.begin(), wide.end(), result); return result; }, reference);
+}
+
+void FormatTime(const std::string& name, const std::string& payload)
+{
+    using namespace boost::posix_time;
+
+    // the whole supported date range, and the special values
+    const boost::uint64_t bits = Bits<boost::uint64_t>(payload);
+    const boost::int64_t range = (boost::gregorian::date(9999, 12, 31) - boost::gregorian::date(1400, 1, 1)).days() * boost::int64_t(86400000000);
+    ptime value;
+    switch (bits % 64)
+    {
+    case 0: value = ptime(not_a_date_time); break;
+    case 1: value = ptime(pos_infin); break;
+    case 2: value = ptime(neg_infin); break;
+    default: value = ptime(boost::gregorian::date(1400, 1, 1)) + microseconds(static_cast<boost::int64_t>((bits / 64) % range));
+    }
+
+    Compare(name, payload, [&] { return conv::cast<std::string>(value); }, [&] { return to_iso_extended_string(value); });
+}
+
+void EpochTime(const std::string& name, const std::string& payload)
+{
+    using namespace boost::posix_time;
+
+    const boost::uint64_t bits = Bits<boost::uint64_t>(payload);
+    const boost::int64_t range = (boost::gregorian::date(9999, 12, 31) - boost::gregorian::date(1400, 1, 1)).days() * boost::int64_t(86400000000);
+    const ptime value = ptime(boost::gregorian::date(1400, 1, 1)) + microseconds(static_cast<boost::int64_t>(bits % range));
+
+    // counts before 1970 or too large for the target throw
+    const ptime epoch(boost::gregorian::date(1970, 1, 1));
+    const time_duration since = value - epoch;
+    const auto nanoseconds = [&]
+    {
+        const boost::int64_t us = since.total_microseconds();
+        if (us > std::numeric_limits<boost::int64_t>::max() / 1000)
+            throw boost::numeric::positive_overflow();
+        return boost::numeric_cast<boost::uint64_t>(us) * 1000;
+    };
+    Compare(name + " ms", payload, [&] { return conv::cast<boost::uint64_t>(value); }, [&] { return boost::numeric_cast<boost::uint64_t>(since.total_milliseconds()); });
+    Compare(name + " s", payload, [&] { return conv::cast<boost::uint32_t>(value); }, [&] { return boost::numeric_cast<boost::uint32_t>(since.ticks() / time_duration::ticks_per_second()); });
+    Compare(name + " us", payload, [&] { return conv::cast<conv::EpochMicroseconds>(value); }, [&] { return boost::numeric_cast<boost::uint64_t>(since.total_microseconds()); });
+    Compare(name + " ns", payload, [&] { return conv::cast<conv::EpochNanoseconds>(value); }, nanoseconds);
+
+    const boost::uint64_t ms = static_cast<boost::uint64_t>(since.total_milliseconds());
+    Compare(name + " from ms", payload, [&] { return conv::cast<ptime>(ms); }, [&] { return epoch + milliseconds(boost::numeric_cast<boost::int64_t>(ms)); });
+    Compare(name + " from us", payload, [&] { return conv::cast<ptime, conv::EpochMicroseconds>(since.total_microseconds()); }, [&] { boost::numeric_cast<boost::uint64_t>(since.total_microseconds()); return value; });
+}
+
+void ChronoTime(const std::string& name, const std::string& payload)
+{
+    typedef std::chrono::time_point<std::chrono::system_clock, std::chrono::microseconds> Micros;
+
+    const boost::uint64_t bits = Bits<boost::uint64_t>(payload);
+    const boost::int64_t range = (boost::gregorian::date(9999, 12, 31) - boost::gregorian::date(1400, 1, 1)).days() * boost::int64_t(86400000000);
+    const boost::posix_time::ptime value = boost::posix_time::ptime(boost::gregorian::date(1400, 1, 1)) + boost::posix_time::microseconds(static_cast<boost::int64_t>(bits % range));
+    const Micros time(std::chrono::microseconds((value - boost::posix_time::ptime(boost::gregorian::date(1970, 1, 1))).total_microseconds()));
+
+    Compare(name + " format", payload, [&] { return conv::cast<std::string>(time); }, [&] { return conv::cast<std::string>(value); });
+    Compare(name + " parse", payload, [&] { return conv::cast<std::string>(conv::cast<Micros>(conv::cast<std::string>(time))); }, [&] { return conv::cast<std::string>(value); });
+
+    const boost::int64_t ticks = static_cast<boost::int64_t>(bits % (range * 2)) - range;
+    Compare(name + " duration", payload, [&] { return conv::cast<std::string>(std::chrono::microseconds(ticks)); }, [&] { return boost::posix_time::to_simple_string(boost::posix_time::microseconds(ticks)); });
+}
+
+//! The date_time facet parse that predates RFC 3339 support
+boost::posix_time::ptime StrictReference(const std::string& payload)
+{
+    boost::posix_time::ptime pt;
+    std::istringstream is((!payload.empty() && payload.back() == 'Z') ? payload.substr(0, payload.size() - 1) : payload);
+    is.imbue(std::locale(std::locale::classic(), new boost::posix_time::time_input_facet("%Y-%m-%dT%H:%M:%S%f")));
+    is >> pt;
+    return pt;
+}
+
+void ParseTime(const std::string& name, const std::string& payload)
+{
+    Compare(name, payload, [&] { return conv::cast<conv::StrictTime>(payload); }, [&] { return StrictReference(payload); });
+}
+
+void ParseRfc3339(const std::string& name, const std::string& payload)
+{
+    using namespace boost::posix_time;
+
+    // pattern matching and date_time arithmetic, the way timestamps were normalized before the parser took offsets
+    // The forms the date_time facet read before are matched too: a date alone, no seconds, 24:00:00, a dot without
+    // digits and text after the fraction
+    const auto reference = [&]
+    {
+        static const std::regex pattern("(\\d{4}-\\d{2}-\\d{2})[Tt ](\\d{2}):(\\d{2}):(\\d{2})(?:(\\.\\d*)([^\\dZz+\\-].*)?)?([Zz]|([+-])(\\d{2}):(\\d{2}))?");
+        static const std::regex legacy("(\\d{4}-\\d{2}-\\d{2})(?:[Tt ](?:(\\d{2}):(\\d{2})|(24:00:00)[Zz]?))?");
+        std::smatch match;
+        const auto inCalendar = [](const ptime& result)
+        {
+            return result < ptime(boost::gregorian::date(1400, 1, 1)) || result.date() > boost::gregorian::date(9999, 12, 31) ? ptime() : result;
+        };
+
+        try
+        {
+            if (std::regex_match(payload, match, legacy))
+            {
+                const int hours = match[2].matched ? std::stoi(match[2]) : 0, minutes = match[3].matched ? std::stoi(match[3]) : 0;
+                if (hours > 23 || minutes > 59)
+                    return ptime();
+                const ptime result(boost::gregorian::from_simple_string(match[1]), time_duration(hours, minutes, 0));
+                return inCalendar(match[4].matched ? result + boost::posix_time::hours(24) : result);
+            }
+
+            if (!std::regex_match(payload, match, pattern))
+                return ptime();
+
+            const int hours = std::stoi(match[2]), minutes = std::stoi(match[3]), seconds = std::stoi(match[4]);
+            if (hours > 23 || minutes > 59 || seconds > 60 || (match[9].matched && (std::stoi(match[9]) > 23 || std::stoi(match[10]) > 59)))
+                return ptime();
+
+            const boost::gregorian::date date = boost::gregorian::from_simple_string(match[1]);
+            const std::string fraction = match[5].matched ? match[5].str().substr(1) + "000000" : "000000";
+            ptime result = ptime(date, time_duration(hours, minutes, seconds) + microseconds(std::stoi(fraction.substr(0, 6))));
+            if (match[8].matched)
+            {
+                const time_duration offset(std::stoi(match[9]), std::stoi(match[10]), 0);
+                result = match[8] == "-" ? result + offset : result - offset;
+            }
+            return inCalendar(result);
+        }
+        catch (const std::exception&)
+        {
+            return ptime();
+        }
+    };
+    Compare(name, payload, [&] { return conv::cast<ptime>(payload); }, reference);
+}
+
+void ParseTimestamps(const std::string& name, const std::string& payload)
+{
+    // lines share prefixes with their neighbours, the parser must not carry anything else over
+    conv::TimestampParser parser;
+    std::istringstream lines(payload);
+    std::string line;
+    while (std::getline(lines, line))
+        Compare(name, line, [&] { return parser(line); }, [&] { return conv::cast<boost::posix_time::ptime>(line); });
+}
+
+//! Epoch counts told apart by digit count and decimal seconds, through date_time arithmetic
+boost::posix_time::ptime AnyTimestampReference(const std::string& text)
+{
+    using namespace boost::posix_time;
+
+    static const std::regex count("[0-9]{1,19}");
+    static const std::regex decimal("([0-9]{1,10})\\.([0-9]+)");
+    static const std::regex iso("[0-9]{4}-.*");
+
+    const ptime epoch(boost::gregorian::date(1970, 1, 1));
+    std::smatch match;
+    if (std::regex_match(text, count))
+    {
+        const boost::uint64_t value = boost::lexical_cast<boost::uint64_t>(text);
+        if (value > static_cast<boost::uint64_t>(std::numeric_limits<boost::int64_t>::max()))
+            return ptime();
+
+        const boost::int64_t signedValue = static_cast<boost::int64_t>(value);
+        if (text.size() <= 10)
+            return epoch + seconds(static_cast<long>(signedValue));
+        if (text.size() <= 13)
+            return epoch + milliseconds(signedValue);
+        if (text.size() <= 16)
+            return epoch + microseconds(signedValue);
+        return epoch + microseconds(signedValue / 1000);
+    }
+    if (std::regex_match(text, match, decimal))
+        return epoch + seconds(std::stol(match[1])) + microseconds(std::stol((match[2].str() + "000000").substr(0, 6)));
+    if (std::regex_match(text, iso))
+        return conv::cast<ptime>(text);
+    return ptime();
+}
+
+void ParseAnyTimestamp(const std::string& name, const std::string& payload)
+{
+    using boost::posix_time::ptime;
+
+    std::vector<std::string> column;
+    std::istringstream lines(payload);
+    std::string line;
+    while (std::getline(lines, line))
+    {
+        Compare(name, line, [&] { return conv::cast<ptime, conv::AnyTimestamp>(line); }, [&] { return AnyTimestampReference(line); });
+        column.push_back(line);
+    }
+
+    std::vector<ptime> batch(column.size());
+    conv::cast<ptime, conv::AnyTimestamp>(column.data(), column.data() + column.size(), batch.data());
+    for (std::size_t i = 0; i < column.size(); ++i)
+        Compare(name + " batch", column[i], [&] { return batch[i]; }, [&] { return conv::cast<ptime, conv::AnyTimestamp>(column[i]); });
+}
+
+//! Every caster with a direct form writes the same into arena memory, a small buffer makes most inputs take chunks
+void Arena(const std::string& name, const std::string& payload)
+{
+    char buffer[32];
+    conv::MonotonicArena arena(buffer, sizeof(buffer));
+    const conv::Allocator<char> alloc(&arena);
+
+    const std::vector<char> data(payload.begin(), payload.end());
+    const std::vector<unsigned char> bytes(payload.begin(), payload.end());
+    const std::wstring wide = Wide(payload);
+
+    Compare(name + " base64 encode", payload, [&] { return conv::cast<conv::Base64>(payload, alloc); }, [&] { return conv::cast<conv::Base64>(payload); });
+    Compare(name + " base64 encode vector<char>", payload, [&] { return conv::cast<std::string>(data, alloc); }, [&] { return conv::cast<std::string>(data); });
+    Compare(name + " base64 encode vector<unsigned char>", payload, [&] { return conv::cast<std::string>(bytes, alloc); }, [&] { return conv::cast<std::string>(bytes); });
+    Compare(name + " base64 decode", payload, [&] { return conv::cast<std::string, conv::Base64>(payload, alloc); }, [&] { return conv::cast<std::string, conv::Base64>(payload); });
+    Compare(name + " base64 decode vector<char>", payload, [&] { return conv::cast<std::vector<char> >(payload, alloc); }, [&] { return conv::cast<std::vector<char> >(payload); });
+    Compare(name + " base64 decode vector<unsigned char>", payload, [&] { return conv::cast<std::vector<unsigned char> >(payload, alloc); }, [&] { return conv::cast<std::vector<unsigned char> >(payload); });
+    Compare(name + " hex encode", payload, [&] { return conv::cast<conv::Hex>(data, alloc); }, [&] { return conv::cast<conv::Hex>(data); });
+    Compare(name + " hex decode", payload, [&] { return conv::cast<std::vector<char>, conv::Hex>(payload, alloc); }, [&] { return conv::cast<std::vector<char>, conv::Hex>(payload); });
+    Compare(name + " number list", payload, [&] { return conv::cast<std::vector<boost::uint64_t> >(payload, alloc); }, [&] { return conv::cast<std::vector<boost::uint64_t> >(payload); });
+    Compare(name + " string list", payload, [&] { return conv::cast<std::vector<std::string> >(payload, alloc); }, [&] { return conv::cast<std::vector<std::string> >(payload); });
+    Compare(name + " utf8 to wide", payload, [&] { return conv::cast<std::wstring>(payload, alloc); }, [&] { return conv::cast<std::wstring>(payload); });
+    Compare(name + " wide to utf8", payload, [&] { return conv::cast<std::string>(wide, alloc); }, [&] { return conv::cast<std::string>(wide); });
+    Compare(name + " cp1251 to utf8", payload, [&] { return conv::cast<std::string, conv::Ansi>(payload, alloc); }, [&] { return conv::cast<std::string, conv::Ansi>(payload); });
+    Compare(name + " cp1251 to wide", payload, [&] { return conv::cast<std::wstring, conv::Ansi>(payload, alloc); }, [&] { return conv::cast<std::wstring, conv::Ansi>(payload); });
+    Compare(name + " wide to cp1251", payload, [&] { return conv::cast<conv::Ansi>(wide, alloc); }, [&] { return conv::cast<conv::Ansi>(wide); });
+}
+
+//! Target left over from an earlier cast, longer than most results so stale contents would show
+template<typename Result, typename Cast>
+Result Refill(Result target, Cast cast)
+{
+    cast(target);
+    return target;
+}
+
+void Reuse(const std::string& name, const std::string& payload)
+{
+    const std::vector<char> data(payload.begin(), payload.end());
+    const std::wstring wide = Wide(payload);
+    const std::string text(64, '#');
+    const std::wstring wideText(64, L'#');
+    const std::vector<char> binary(64, '#');
+    const std::vector<std::string> list(4, text);
+
+    Compare(name + " base64 encode", payload, [&] { return Refill(text, [&](std::string& out) { conv::cast_into<conv::Base64>(out, payload); }); }, [&] { return conv::cast<conv::Base64>(payload); });
+    Compare(name + " base64 decode", payload, [&] { return Refill(text, [&](std::string& out) { conv::cast_into<std::string, conv::Base64>(out, payload); }); }, [&] { return conv::cast<std::string, conv::Base64>(payload); });
+    Compare(name + " base64 decode vector<char>", payload, [&] { return Refill(binary, [&](std::vector<char>& out) { conv::cast_into(out, payload); }); }, [&] { return conv::cast<std::vector<char> >(payload); });
+    Compare(name + " hex encode", payload, [&] { return Refill(text, [&](std::string& out) { conv::cast_into<conv::Hex>(out, data); }); }, [&] { return conv::cast<conv::Hex>(data); });
+    Compare(name + " hex decode", payload, [&] { return Refill(binary, [&](std::vector<char>& out) { conv::cast_into<std::vector<char>, conv::Hex>(out, payload); }); }, [&] { return conv::cast<std::vector<char>, conv::Hex>(payload); });
+    Compare(name + " number list", payload, [&] { return Refill(std::vector<boost::uint64_t>(4, 7), [&](std::vector<boost::uint64_t>& out) { conv::cast_into(out, payload); }); }, [&] { return conv::cast<std::vector<boost::uint64_t> >(payload); });
+    Compare(name + " string list", payload, [&] { return Refill(list, [&](std::vector<std::string>& out) { conv::cast_into(out, payload); }); }, [&] { return conv::cast<std::vector<std::string> >(payload); });
+    Compare(name + " utf8 to wide", payload, [&] { return Refill(wideText, [&](std::wstring& out) { conv::cast_into(out, payload); }); }, [&] { return conv::cast<std::wstring>(payload); });
+    Compare(name + " wide to utf8", payload, [&] { return Refill(text, [&](std::string& out) { conv::cast_into(out, wide); }); }, [&] { return conv::cast<std::string>(wide); });
+    Compare(name + " cp1251 to wide", payload, [&] { return Refill(wideText, [&](std::wstring& out) { conv::cast_into<std::wstring, conv::Ansi>(out, payload); }); }, [&] { return conv::cast<std::wstring, conv::Ansi>(payload); });
+    Compare(name + " wide to cp1251", payload, [&] { return Refill(text, [&](std::string& out) { conv::cast_into<conv::Ansi>(out, wide); }); }, [&] { return conv::cast<conv::Ansi>(wide); });
+    Compare(name + " number", payload, [&] { return Refill(text, [&](std::string& out) { conv::cast_into(out, Bits<boost::int64_t>(payload)); }); }, [&] { return conv::cast<std::string>(Bits<boost::int64_t>(payload)); });
+}
+
+void InlineString(const std::string& name, const std::string& payload)
+{
+    using namespace boost::posix_time;
+
+    const boost::uint64_t bits = Bits<boost::uint64_t>(payload);
+    const boost::int64_t range = (boost::gregorian::date(9999, 12, 31) - boost::gregorian::date(1400, 1, 1)).days() * boost::int64_t(86400000000);
+    const ptime time = ptime(boost::gregorian::date(1400, 1, 1)) + microseconds(static_cast<boost::int64_t>(bits % range));
+    const time_duration duration = microseconds(static_cast<boost::int64_t>(bits));
+
+    Compare(name + " uint64", payload, [&] { return std::string(conv::cast<conv::Inline<boost::uint64_t> >(bits)); }, [&] { return conv::cast<std::string>(bits); });
+    Compare(name + " int64", payload, [&] { return std::string(conv::cast<conv::Inline<boost::int64_t> >(static_cast<boost::int64_t>(bits))); }, [&] { return conv::cast<std::string>(static_cast<boost::int64_t>(bits)); });
+    Compare(name + " int", payload, [&] { return std::string(conv::cast<conv::Inline<int> >(Bits<int>(payload))); }, [&] { return conv::cast<std::string>(Bits<int>(payload)); });
+    Compare(name + " double", payload, [&] { return std::string(conv::cast<conv::Inline<double> >(Bits<double>(payload))); }, [&] { return conv::cast<std::string>(Bits<double>(payload)); });
+    Compare(name + " float", payload, [&] { return std::string(conv::cast<conv::Inline<float> >(Bits<float>(payload))); }, [&] { return conv::cast<std::string>(Bits<float>(payload)); });
+    Compare(name + " ptime", payload, [&] { return std::string(conv::cast<conv::Inline<ptime> >(time)); }, [&] { return conv::cast<std::string>(time); });
+    Compare(name + " time_duration", payload, [&] { return std::string(conv::cast<conv::Inline<time_duration> >(duration)); }, [&] { return conv::cast<std::string>(duration); });
+    Compare(name + " date", payload, [&] { return std::string(conv::cast<conv::Inline<boost::gregorian::date> >(time.date())); }, [&] { return conv::cast<std::string>(time.date()); });
+}
+
+//! Small tables so inputs of one run collide and evict each other, every cast is checked on the miss and on the hit
+void Cached(const std::string& name, const std::string& payload)
+{
+    const std::string head = payload.substr(0, payload.size() / 2);
+    for (const std::string& input : { payload, head, payload })
+    {
+        Compare(name + " int", input, [&] { return conv::CachedCaster<int, std::string, 4>()(input); }, [&] { return conv::cast<int>(input); });
+        Compare(name + " base64 decode", input, [&] { return conv::CachedCaster<std::vector<char>, std::string, 4>()(input); }, [&] { return conv::cast<std::vector<char> >(input); });
+        Compare(name + " ptime", input, [&] { return conv::CachedCaster<boost::posix_time::ptime, std::string, 4>()(input); }, [&] { return conv::cast<boost::posix_time::ptime>(input); });
+        Compare(name + " utf8 to wide", input, [&] { return conv::CachedCaster<std::wstring, std::string, 4>()(input); }, [&] { return conv::cast<std::wstring>(input); });
+    }
+}
+
+//! Blocks of one to eight units, so the stages split the payload in many places
+void Pipe(const std::string& name, const std::string& payload)
+{
+    const std::size_t block = payload.empty() ? 1 : static_cast<unsigned char>(payload[0]) % 8 + 1;
+    const std::wstring wide = Wide(payload);
+
+    Compare(name + " cp1251 to base64", payload, [&] { return conv::pipe<conv::Ansi, std::string, conv::Base64>(payload, block); }, [&] { return conv::cast<conv::Base64>(conv::cast<std::string, conv::Ansi>(payload)); });
+    Compare(name + " wide to hex", payload, [&] { return conv::pipe<std::wstring, std::string, conv::Hex>(wide, block); }, [&] { return conv::cast<conv::Hex>(conv::cast<std::string>(wide)); });
+    Compare(name + " base64 to wide", payload, [&] { return conv::pipe<conv::Base64, std::string, std::wstring>(payload, block); }, [&] { return conv::cast<std::wstring>(conv::cast<std::string, conv::Base64>(payload)); });
+    Compare(name + " hex to cp1251", payload, [&] { return conv::pipe<conv::Hex, std::string, std::wstring, conv::Ansi>(payload, block); }, [&] { return conv::cast<conv::Ansi>(conv::cast<std::wstring>(conv::cast<std::string, conv::Hex>(payload))); });
+    Compare(name + " utf8 to wide", payload, [&] { return conv::pipe<std::string, std::wstring>(payload, block); }, [&] { return conv::cast<std::wstring>(payload); });
+    Compare(name + " base64 to hex", payload, [&] { return conv::pipe<std::string, std::vector<char>, conv::Hex>(payload, block); }, [&] { return conv::cast<conv::Hex>(conv::cast<std::vector<char> >(payload)); });
+}
+
+void Duration(const std::string& name, const std::string& payload)
+{
+    using namespace boost::posix_time;
+
+    // up to a hundred million hours either way
+    const boost::int64_t range = boost::int64_t(100000000) * 3600 * 1000000;
+    const time_duration value = microseconds(static_cast<boost::int64_t>(Bits<boost::uint64_t>(payload) % (range * 2)) - range);
+
+    Compare(name + " format", payload, [&] { return conv::cast<std::string>(value); }, [&] { return to_simple_string(value); });
+    Compare(name + " parse", payload, [&] { return conv::cast<time_duration>(to_simple_string(value)); }, [&] { return value; });
+    Compare(name + " ms", payload, [&] { return conv::cast<boost::int64_t>(value); }, [&] { return static_cast<boost::int64_t>(value.total_milliseconds()); });
+    Compare(name + " from ms", payload, [&] { return conv::cast<time_duration>(value.total_milliseconds()); }, [&] { return time_duration(milliseconds(value.total_milliseconds())); });
+    Compare(name + " s", payload, [&] { return conv::cast<boost::int32_t>(value); }, [&] { return boost::numeric_cast<boost::int32_t>(value.ticks() / time_duration::ticks_per_second()); });
+    const boost::int32_t count = static_cast<boost::int32_t>(value.ticks() / time_duration::ticks_per_second());
+    Compare(name + " from s", payload, [&] { return conv::cast<time_duration>(count); }, [&] { return time_duration(0, 0, 0, boost::int64_t(count) * time_duration::ticks_per_second()); });
+}
+
+void Date(const std::string& name, const std::string& payload)
+{
+    using boost::gregorian::date;
+
+    const date first(1400, 1, 1);
+    const date value = first + boost::gregorian::days(static_cast<long>(Bits<boost::uint32_t>(payload) % ((date(9999, 12, 31) - first).days() + 1)));
+
+    Compare(name + " format", payload, [&] { return conv::cast<std::string>(value); }, [&] { return boost::gregorian::to_iso_extended_string(value); });
+    Compare(name + " parse", payload, [&] { return conv::cast<date>(boost::gregorian::to_iso_extended_string(value)); }, [&] { return value; });
+    Compare(name + " days", payload, [&] { return conv::cast<boost::int32_t>(value); }, [&] { return static_cast<boost::int32_t>((value - date(1970, 1, 1)).days()); });
+}
+
+struct Berlin { static const char* Name() { return "Europe/Berlin"; } };
+struct Sydney { static const char* Name() { return "Australia/Sydney"; } };
+struct NewYork { static const char* Name() { return "America/New_York"; } };
+struct Chatham { static const char* Name() { return "Pacific/Chatham"; } };
+
+//! Local time in the zone against the C library, which reads the same tzdata file through TZ
+template<typename Zone>
+void LocalTimeIn(const std::string& name, const std::string& payload, const boost::posix_time::ptime& value)
+{
+    const auto reference = [&]
+    {
+        setenv("TZ", Zone::Name(), 1);
+        tzset();
+
+        const std::time_t seconds = static_cast<std::time_t>(conv::cast<boost::uint32_t>(value));
+        std::tm local;
+        localtime_r(&seconds, &local);
+        return value + boost::posix_time::seconds(local.tm_gmtoff);
+    };
+    Compare(name + " " + Zone::Name(), payload, [&] { return conv::cast<conv::LocalTime<Zone> >(value); }, reference);
+}
+
+void LocalTime(const std::string& name, const std::string& payload)
+{
+    // 1970 to 2099, both sides expand the rules of the zone past its last transition
+    const boost::uint64_t bits = Bits<boost::uint64_t>(payload);
+    const boost::int64_t range = (boost::gregorian::date(2099, 12, 31) - boost::gregorian::date(1970, 1, 1)).days() * boost::int64_t(86400000000);
+    const boost::posix_time::ptime value = boost::posix_time::ptime(boost::gregorian::date(1970, 1, 1)) + boost::posix_time::microseconds(static_cast<boost::int64_t>(bits % range));
+
+    LocalTimeIn<Berlin>(name, payload, value);
+    LocalTimeIn<Sydney>(name, payload, value);
+    LocalTimeIn<NewYork>(name, payload, value);
+    LocalTimeIn<Chatham>(name, payload, value);
+}
+
+void EncodeHex(const std::string& name, const std::string& payload)
+{
+    const std::vector<char> data(payload.begin(), payload.end());
+    Compare(name, payload, [&] { return conv::cast<conv::Hex>(data); }, [&] { std::string result; stlencoders::base16<char>::encode(data.begin(), data.end(), std::back_inserter(result)); return result; });
+}
+
+void DecodeHex(const std::string& name, const std::string& payload)
+{
+    Compare(name, payload, [&] { return conv::cast<std::vector<char>, conv::Hex>(payload); }, [&] { std::vector<char> result; stlencoders::base16<char>::decode(payload.begin(), payload.end(), std::back_inserter(result)); return result; });
+}
+
+void EncodeBase64(const std::string& name, const std::string& payload)
+{
+    const auto reference = [&] { std::string result; stlencoders::base64<char>::encode(payload.begin(), payload.end(), std::back_inserter(result)); return result; };
+    const std::vector<char> chars(payload.begin(), payload.end());
+    const std::vector<unsigned char> bytes(payload.begin(), payload.end());
+
+    Compare(name, payload, [&] { return conv::cast<conv::Base64>(payload); }, reference);
+    Compare(name + " vector<char>", payload, [&] { return conv::cast<std::string>(chars); }, reference);
+    Compare(name + " vector<unsigned char>", payload, [&] { return conv::cast<std::string>(bytes); }, reference);
+}
+
+void DecodeBase64(const std::string& name, const std::string& payload)
+{
+    const auto reference = [&] { std::string result; stlencoders::base64<char>::decode(payload.begin(), payload.end(), std::back_inserter(result)); return result; };
+
+    Compare(name, payload, [&] { return conv::cast<std::string, conv::Base64>(payload); }, reference);
+    Compare(name + " vector<char>", payload, [&] { const auto v = conv::cast<std::vector<char> >(payload); return std::string(v.begin(), v.end()); }, reference);
+    Compare(name + " vector<unsigned char>", payload, [&] { const auto v = conv::cast<std::vector<unsigned char> >(payload); return std::string(v.begin(), v.end()); }, reference);
+}
+
+void ParseNumberList(const std::string& name, const std::string& payload)
+{
+    const auto reference = [&]
+    {
+        std::vector<boost::uint64_t> result;
+        if (payload.empty())
+            return result;
+
+        std::string::size_type begin = 0;
+        for (;;)
+        {
+            const std::string::size_type end = payload.find(',', begin);
+            result.push_back(boost::lexical_cast<boost::uint64_t>(payload.substr(begin, end - begin)));
+            if (end == std::string::npos)
+                return result;
+            begin = end + 1;
+        }
+    };
+    Compare(name, payload, [&] { return conv::cast<std::vector<boost::uint64_t> >(payload); }, reference);
+}
+
+void ParseStringList(const std::string& name, const std::string& payload)
+{
+    const auto reference = [&]
+    {
+        std::vector<std::string> result(1);
+        for (const char c : payload)
+        {
+            if (c == ',')
+                result.emplace_back();
+            else
+                result.back().push_back(c);
+        }
+        return result;
+    };
+    Compare(name, payload, [&] { return conv::cast<std::vector<std::string> >(payload); }, reference);
+    Compare(name + " join", payload, [&] { return conv::cast<std::string>(conv::cast<std::vector<std::string> >(payload)); }, [&] { return payload; });
+}
+
+void BitList(const std::string& name, const std::string& payload)
+{
+    const unsigned value = Bits<unsigned>(payload);
+    const auto reference = [&]
+    {
+        std::vector<unsigned> result;
+        for (unsigned i = 0; i < 32; ++i)
+        {
+            if (value & (1u << i))
+                result.push_back(i);
+        }
+        return result;
+    };
+    Compare(name, payload, [&] { return conv::cast<std::vector<unsigned> >(value); }, reference);
+    Compare(name + " back", payload, [&] { return conv::cast<unsigned>(reference()); }, [&] { return value; });
+}
+
+//! RFC 4648 alphabet of a codec, independent of the stlencoders traits
+struct Alphabet
+{
+    const char* m_Upper;
+    unsigned m_Bits;
+    bool m_CaseInsensitive;
+    bool m_Padded;
+
+    //! Characters per group, the encoded length is padded to a multiple of it
+    std::size_t Group() const
+    {
+        std::size_t group = 1;
+        while (group * m_Bits % 8)
+            ++group;
+        return group;
+    }
+
+    template<typename Char>
+    int Value(const Char c) const
+    {
+        if (c < 0 || c > 0x7F || c == 0)
+            return -1;
+
+        const char narrow = static_cast<char>(c);
+        const char* found = std::strchr(m_Upper, m_CaseInsensitive ? std::toupper(narrow) : narrow);
+        return found ? static_cast<int>(found - m_Upper) : -1;
+    }
+};
+
+template<typename Char>
+std::basic_string<Char> ReferenceEncode(const Alphabet& alphabet, const std::string& data, const bool lower)
+{
+    std::basic_string<Char> result;
+    unsigned buffer = 0;
+    unsigned bits = 0;
+    const auto emit = [&](const unsigned value)
+    {
+        const char c = alphabet.m_Upper[value];
+        result.push_back(static_cast<Char>(lower ? std::tolower(c) : c));
+    };
+
+    for (const char c : data)
+    {
+        buffer = (buffer << 8) | static_cast<unsigned char>(c);
+        bits += 8;
+        while (bits >= alphabet.m_Bits)
+        {
+            bits -= alphabet.m_Bits;
+            emit((buffer >> bits) & ((1u << alphabet.m_Bits) - 1));
+        }
+    }
+    if (bits)
+        emit((buffer << (alphabet.m_Bits - bits)) & ((1u << alphabet.m_Bits) - 1));
+
+    while (alphabet.m_Padded && result.size() % alphabet.Group())
+        result.push_back(Char('='));
+    return result;
+}
+
+//! Groups may end early, by padding or end of input, only where the characters read so far complete an octet;
+//! padding stops decoding and anything after it is ignored, leftover bits are dropped
+template<typename Char>
+std::string ReferenceDecode(const Alphabet& alphabet, const std::basic_string<Char>& input)
+{
+    std::string result;
+    unsigned buffer = 0;
+    unsigned bits = 0;
+    std::size_t position = 0;
+
+    for (const Char c : input)
+    {
+        const int value = alphabet.Value(c);
+        if (value < 0)
+        {
+            if (!alphabet.m_Padded || c != Char('='))
+                throw stlencoders::invalid_character("reference decode error");
+            break;
+        }
+
+        buffer = (buffer << alphabet.m_Bits) | static_cast<unsigned>(value);
+        bits += alphabet.m_Bits;
+        if (bits >= 8)
+        {
+            bits -= 8;
+            result.push_back(static_cast<char>((buffer >> bits) & 0xFF));
+        }
+        position = (position + 1) % alphabet.Group();
+    }
+
+    // the last character must have completed an octet
+    if (position && (position * alphabet.m_Bits) / 8 == ((position - 1) * alphabet.m_Bits) / 8)
+        throw stlencoders::invalid_length("reference decode error");
+    return result;
+}
+
+struct NeverSkip
+{
+    template<typename Char>
+    bool operator () (const Char) const { return false; }
+};
+
+template<typename Codec>
+std::basic_string<typename Codec::char_type> Encode(const std::string& data)
+{
+    std::basic_string<typename Codec::char_type> result;
+    Codec::encode(data.begin(), data.end(), std::back_inserter(result));
+    return result;
+}
+
+//! Every encode and decode path of the codec against the reference, and the round trip
+template<typename Codec, typename Lowercase>
+void CheckCodec(const Alphabet& alphabet, const std::string& name, const std::string& payload, Lowercase lowercase)
+{
+    typedef typename Codec::char_type Char;
+    typedef std::basic_string<Char> String;
+
+    // encoding, random access and single pass input
+    Compare(name + " encode", payload, [&] { return Encode<Codec>(payload); }, [&] { return ReferenceEncode<Char>(alphabet, payload, false); });
+    Compare(name + " encode input iterator", payload, [&]
+    {
+        const std::list<unsigned char> data(payload.begin(), payload.end());
+        String result;
+        Codec::encode(data.begin(), data.end(), std::back_inserter(result));
+        return result;
+    }, [&] { return ReferenceEncode<Char>(alphabet, payload, false); });
+    lowercase(payload);
+
+    // decoding of arbitrary text, with and without the skip predicate
+    const String text(payload.begin(), payload.end());
+    const auto reference = [&] { return ReferenceDecode(alphabet, text); };
+    Compare(name + " decode", payload, [&] { std::string result; Codec::decode(text.begin(), text.end(), std::back_inserter(result)); return result; }, reference);
+    Compare(name + " decode skip", payload, [&] { std::string result; Codec::decode(text.begin(), text.end(), std::back_inserter(result), NeverSkip()); return result; }, reference);
+
+    // round trip
+    Compare(name + " round trip", payload, [&]
+    {
+        const String encoded = Encode<Codec>(payload);
+        std::string result;
+        Codec::decode(encoded.begin(), encoded.end(), std::back_inserter(result));
+        return result;
+    }, [&] { return payload; });
+}
+
+template<typename Codec>
+void CaseCodec(const Alphabet& alphabet, const std::string& name, const std::string& payload)
+{
+    typedef typename Codec::char_type Char;
+
+    CheckCodec<Codec>(alphabet, name, payload, [&](const std::string&)
+    {
+        Compare(name + " encode lower", payload, [&]
+        {
+            std::basic_string<Char> result;
+            Codec::encode_lower(payload.begin(), payload.end(), std::back_inserter(result));
+            return result;
+        }, [&] { return ReferenceEncode<Char>(alphabet, payload, true); });
+        Compare(name + " encode upper", payload, [&]
+        {
+            std::basic_string<Char> result;
+            Codec::encode_upper(payload.begin(), payload.end(), std::back_inserter(result));
+            return result;
+        }, [&] { return ReferenceEncode<Char>(alphabet, payload, false); });
+    });
+}
+
+template<typename Codec>
+void PlainCodec(const Alphabet& alphabet, const std::string& name, const std::string& payload)
+{
+    CheckCodec<Codec>(alphabet, name, payload, [](const std::string&) {});
+}
+
+const Alphabet g_Base2 = { "01", 1, false, false };
+const Alphabet g_Base16 = { "0123456789ABCDEF", 4, true, false };
+const Alphabet g_Base32 = { "ABCDEFGHIJKLMNOPQRSTUVWXYZ234567", 5, true, true };
+const Alphabet g_Base32Hex = { "0123456789ABCDEFGHIJKLMNOPQRSTUV", 5, true, true };
+const Alphabet g_Base64 = { "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/", 6, false, true };
+const Alphabet g_Base64Url = { "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_", 6, false, true };
+
+template<typename Char>
+void Base2(const std::string& name, const std::string& payload) { PlainCodec<stlencoders::base2<Char> >(g_Base2, name, payload); }
+
+template<typename Char>
+void Base16(const std::string& name, const std::string& payload) { CaseCodec<stlencoders::base16<Char> >(g_Base16, name, payload); }
+
+template<typename Char>
+void Base32(const std::string& name, const std::string& payload) { CaseCodec<stlencoders::base32<Char> >(g_Base32, name, payload); }
+
+template<typename Char>
+void Base32Hex(const std::string& name, const std::string& payload) { CaseCodec<stlencoders::base32<Char, stlencoders::base32hex_traits<Char> > >(g_Base32Hex, name, payload); }
+
+template<typename Char>
+void Base64(const std::string& name, const std::string& payload) { PlainCodec<stlencoders::base64<Char> >(g_Base64, name, payload); }
+
+template<typename Char>
+void Base64Url(const std::string& name, const std::string& payload) { PlainCodec<stlencoders::base64<Char, stlencoders::base64url_traits<Char> > >(g_Base64Url, name, payload); }
+
+struct Check
+{
+    const char* m_Name;
+    void (*m_Run)(const std::string& name, const std::string& payload);
+};
+
+//! New entries go to the end, the corpus files select checks by index
+const Check g_Checks[] =
+{
+    { "parse int", &ParseInteger<int> },
+    { "parse unsigned", &ParseInteger<unsigned> },
+    { "parse short", &ParseInteger<short> },
+    { "parse unsigned short", &ParseInteger<unsigned short> },
+    { "parse long long", &ParseInteger<long long> },
+    { "parse unsigned long long", &ParseInteger<unsigned long long> },
+    { "format int", &FormatInteger<int> },
+    { "format unsigned", &FormatInteger<unsigned> },
+    { "format short", &FormatInteger<short> },
+    { "format unsigned short", &FormatInteger<unsigned short> },
+    { "format long long", &FormatInteger<long long> },
+    { "format unsigned long long", &FormatInteger<unsigned long long> },
+    { "parse float", &ParseFloat<float> },
+    { "parse double", &ParseFloat<double> },
+    { "format float", &FormatFloat<float> },
+    { "format double", &FormatFloat<double> },
+    { "parse bool", &ParseBool },
+    { "narrow int to short", &Narrow<short, int> },
+    { "narrow int to unsigned char", &Narrow<unsigned char, int> },
+    { "narrow long long to unsigned", &Narrow<unsigned, long long> },
+    { "narrow unsigned to int", &Narrow<int, unsigned> },
+    { "narrow double to int", &Narrow<int, double> },
+    { "narrow double to unsigned long long", &Narrow<unsigned long long, double> },
+    { "narrow double to float", &Narrow<float, double> },
+    { "narrow float to short", &Narrow<short, float> },
+    { "utf8 to wide", &Utf8ToWide },
+    { "wide to utf8", &WideToUtf8 },
+    { "cp1251 to utf8", &AnsiToUtf8 },
+    { "cp1251 to wide", &AnsiToWide },
+    { "wide to cp1251", &WideToAnsi },
+    { "format ptime", &FormatTime },
+    { "parse ptime", &ParseTime },
+    { "hex encode", &EncodeHex },
+    { "hex decode", &DecodeHex },
+    { "base64 caster encode", &EncodeBase64 },
+    { "base64 caster decode", &DecodeBase64 },
+    { "number list", &ParseNumberList },
+    { "string list", &ParseStringList },
+    { "bits", &BitList },
+    { "base2<char>", &Base2<char> },
+    { "base2<wchar_t>", &Base2<wchar_t> },
+    { "base16<char>", &Base16<char> },
+    { "base16<wchar_t>", &Base16<wchar_t> },
+    { "base32<char>", &Base32<char> },
+    { "base32<wchar_t>", &Base32<wchar_t> },
+    { "base32hex<char>", &Base32Hex<char> },
+    { "base32hex<wchar_t>", &Base32Hex<wchar_t> },
+    { "base64<char>", &Base64<char> },
+    { "base64<wchar_t>", &Base64<wchar_t> },
+    { "base64url<char>", &Base64Url<char> },
+    { "base64url<wchar_t>", &Base64Url<wchar_t> },
+    { "epoch ptime", &EpochTime },
+    { "chrono time_point", &ChronoTime },
+    { "parse ptime rfc3339", &ParseRfc3339 },
+    { "timestamp parser", &ParseTimestamps },
+    { "local time", &LocalTime },
+    { "time_duration", &Duration },
+    { "gregorian date", &Date },
+    { "any timestamp", &ParseAnyTimestamp },
+    { "arena", &Arena },
+    { "reuse", &Reuse },
+    { "inline", &InlineString },
+    { "cached", &Cached },
+    { "pipe", &Pipe }
+};
+
+} // namespace
+
+std::size_t CheckCount()
+{
+    return sizeof(g_Checks) / sizeof(g_Checks[0]);
+}
+
+const char* CheckName(const std::size_t index)
+{
+    return g_Checks[index].m_Name;
+}
+
+void RunCheck(const std::size_t index, const std::string& payload)
+{
+    g_Checks[index].m_Run(g_Checks[index].m_Name, payload);
+}
+
+void Run(const unsigned char* data, const std::size_t size)
+{
+    if (!size)
+        return;
+
+    RunCheck(data[0] % CheckCount(), std::string(reinterpret_cast<const char*>(data) + 1, size - 1));
+}
+
+} // namespace fuzz
@@ -0,0 +1,30 @@
+#ifndef ConversionDifferential_h__
+#define ConversionDifferential_h__
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+
+namespace fuzz
+{
+    //! Fast path and reference path disagree
+    struct Mismatch : std::runtime_error
+    {
+        explicit Mismatch(const std::string& what) : std::runtime_error(what) {}
+    };
+
+    //! Number of differential checks, the first input byte selects one of them
+    std::size_t CheckCount();
+
+    //! Name of the check
+    const char* CheckName(std::size_t index);
+
+    //! Runs the check on the payload, throws Mismatch on disagreement
+    void RunCheck(std::size_t index, const std::string& payload);
+
+    //! Runs the check selected by the first byte on the rest of the input
+    void Run(const unsigned char* data, std::size_t size);
+
+} // namespace fuzz
+
+#endif // ConversionDifferential_h__
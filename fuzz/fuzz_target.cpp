@@ -0,0 +1,20 @@
+#include "differential.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+//! libFuzzer entry point, a mismatch aborts so that the input is saved as a crash
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t* data, std::size_t size)
+{
+    try
+    {
+        fuzz::Run(data, size);
+    }
+    catch (const fuzz::Mismatch& e)
+    {
+        std::fprintf(stderr, "%s\n", e.what());
+        std::abort();
+    }
+    return 0;
+}
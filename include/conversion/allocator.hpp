@@ -0,0 +1,194 @@
+#ifndef ConversionAllocator_h__
+#define ConversionAllocator_h__
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "conversion/details/caster.hpp"
+
+namespace conv
+{
+    //! Source of memory for Allocator, mirrors std::pmr::memory_resource for C++14
+    class MemoryResource
+    {
+    public:
+        virtual ~MemoryResource() {}
+
+        void* Allocate(const std::size_t bytes, const std::size_t alignment = alignof(std::max_align_t))
+        {
+            return DoAllocate(bytes, alignment);
+        }
+
+        void Deallocate(void* p, const std::size_t bytes, const std::size_t alignment = alignof(std::max_align_t))
+        {
+            DoDeallocate(p, bytes, alignment);
+        }
+
+        bool IsEqual(const MemoryResource& other) const
+        {
+            return this == &other || DoIsEqual(other);
+        }
+
+    private:
+        virtual void* DoAllocate(std::size_t bytes, std::size_t alignment) = 0;
+        virtual void DoDeallocate(void* p, std::size_t bytes, std::size_t alignment) = 0;
+        virtual bool DoIsEqual(const MemoryResource& other) const = 0;
+    };
+
+    //! Global operator new and delete, the default resource of Allocator
+    MemoryResource* NewDeleteResource();
+
+    //! Hands out memory by bumping a pointer through chunks, deallocation does nothing and everything is
+    //! returned at once by Release() or the destructor, meant for the short lived results of one request
+    class MonotonicArena : public MemoryResource
+    {
+    public:
+        //! Chunks come from upstream, the first one is initialSize bytes and each next one doubles
+        explicit MonotonicArena(std::size_t initialSize = 1024, MemoryResource* upstream = NewDeleteResource());
+
+        //! The buffer, usually on the stack, is used up before anything is taken from upstream
+        MonotonicArena(void* buffer, std::size_t size, MemoryResource* upstream = NewDeleteResource());
+
+        ~MonotonicArena();
+
+        MonotonicArena(const MonotonicArena&) = delete;
+        MonotonicArena& operator = (const MonotonicArena&) = delete;
+
+        //! Returns the chunks to upstream and starts over from the buffer, everything allocated before is invalidated
+        void Release();
+
+    private:
+        struct Chunk;
+
+        void* DoAllocate(std::size_t bytes, std::size_t alignment) override;
+        void DoDeallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+        bool DoIsEqual(const MemoryResource& other) const override;
+
+        MemoryResource* m_Upstream;
+        char* m_Buffer;
+        std::size_t m_BufferSize;
+        std::size_t m_InitialSize;
+        std::size_t m_NextSize;
+        char* m_Current;
+        char* m_End;
+        Chunk* m_Chunks;
+    };
+
+    //! Polymorphic allocator over MemoryResource, mirrors std::pmr::polymorphic_allocator for C++14
+    //! Containers of containers pass it on to their elements, copies of a container go back to the default resource
+    template<typename T>
+    class Allocator
+    {
+    public:
+        typedef T value_type;
+
+        Allocator() : m_Resource(NewDeleteResource())
+        {
+        }
+
+        Allocator(MemoryResource* resource) : m_Resource(resource)
+        {
+        }
+
+        template<typename U>
+        Allocator(const Allocator<U>& other) : m_Resource(other.Resource())
+        {
+        }
+
+        T* allocate(const std::size_t n)
+        {
+            if (n > std::size_t(-1) / sizeof(T))
+                throw std::bad_alloc();
+            return static_cast<T*>(m_Resource->Allocate(n * sizeof(T), alignof(T)));
+        }
+
+        void deallocate(T* p, const std::size_t n)
+        {
+            m_Resource->Deallocate(p, n * sizeof(T), alignof(T));
+        }
+
+        template<typename U, typename... Args>
+        void construct(U* p, Args&&... args)
+        {
+            Construct(p, std::integral_constant<bool, std::uses_allocator<U, Allocator>::value && std::is_constructible<U, Args..., const Allocator&>::value>(), std::forward<Args>(args)...);
+        }
+
+        Allocator select_on_container_copy_construction() const
+        {
+            return Allocator();
+        }
+
+        MemoryResource* Resource() const
+        {
+            return m_Resource;
+        }
+
+    private:
+        template<typename U, typename... Args>
+        void Construct(U* p, std::true_type, Args&&... args)
+        {
+            ::new (static_cast<void*>(p)) U(std::forward<Args>(args)..., *this);
+        }
+
+        template<typename U, typename... Args>
+        void Construct(U* p, std::false_type, Args&&... args)
+        {
+            ::new (static_cast<void*>(p)) U(std::forward<Args>(args)...);
+        }
+
+        MemoryResource* m_Resource;
+    };
+
+    template<typename T, typename U>
+    bool operator == (const Allocator<T>& left, const Allocator<U>& right)
+    {
+        return left.Resource()->IsEqual(*right.Resource());
+    }
+
+    template<typename T, typename U>
+    bool operator != (const Allocator<T>& left, const Allocator<U>& right)
+    {
+        return !(left == right);
+    }
+
+    typedef std::basic_string<char, std::char_traits<char>, Allocator<char> > String;
+    typedef std::basic_string<wchar_t, std::char_traits<wchar_t>, Allocator<wchar_t> > WString;
+
+    template<typename T>
+    using Vector = std::vector<T, Allocator<T> >;
+
+	namespace details
+	{
+        template<typename Target, typename From, typename Source, typename T>
+        typename Allocated<typename TypeTraits<Target>::Type>::Type CastWithAllocator(const Source& value, const Allocator<T>& alloc)
+        {
+            typedef typename Allocated<typename TypeTraits<Target>::Type>::Type Result;
+
+            Result result{ typename Result::allocator_type(alloc) };
+            stats::InvokeInto<Caster<Target, From> >(value, result);
+            return result;
+        }
+	} // namespace details
+
+    //! Cast function, the result lives in memory of alloc, such as an Allocator over a MonotonicArena
+    //! Available for casters that produce strings and vectors
+    template<typename Target, typename Source, typename T>
+    inline typename details::Allocated<typename details::TypeTraits<Target>::Type>::Type cast(const Source& value, const Allocator<T>& alloc)
+    {
+        return details::CastWithAllocator<Target, Source, Source>(value, alloc);
+    }
+
+    //! Cast function
+    template<typename Target, typename From, typename Source, typename T>
+    inline typename details::Allocated<typename details::TypeTraits<Target>::Type>::Type cast(const Source& value, const Allocator<T>& alloc)
+    {
+        return details::CastWithAllocator<Target, From>(value, alloc);
+    }
+} // namespace conv
+
+#endif // ConversionAllocator_h__
@@ -0,0 +1,206 @@
+#ifndef ConversionBinary_h__
+#define ConversionBinary_h__
+
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "stlencoders/base64.hpp"
+#include "conversion/numeric.hpp"
+
+namespace conv
+{
+    struct Base64 {};
+    struct Hex {};
+
+	namespace details
+	{
+        template<>
+        struct TypeTraits<Base64>
+        {
+            typedef std::string Type;
+        };
+
+        template<>
+        struct TypeTraits<Hex>
+        {
+            typedef std::string Type;
+        };
+
+        template<typename T>
+        struct CharTraits
+        {
+            typedef T type;
+        };
+
+        template<>
+        struct CharTraits<char>
+        {
+            typedef char type;
+        };
+        template<>
+        struct CharTraits<unsigned char>
+        {
+            typedef char type;
+        };
+
+        //! Bin to base64 help struct
+        template<typename Source>
+        struct Caster<Base64, Source>
+        {
+            std::string operator () (const Source& src)
+            {
+                std::string result;
+                Into(src, result);
+                return result;
+            }
+
+            //! Replaces the contents of a string of any allocator
+            template<typename Result>
+            void Into(const Source& src, Result& out)
+            {
+                typedef stlencoders::base64<typename CharTraits<typename Source::value_type>::type> Codec;
+
+                if (src.empty())
+                {
+                    out.clear();
+                    return;
+                }
+
+                // sized up front and written through a pointer, back_inserter costs a capacity check per character
+                out.resize(Codec::max_encode_size(src.size()));
+                const auto begin = &out[0];
+                out.resize(Codec::encode(src.begin(), src.end(), begin) - begin);
+            }
+        };
+
+        template<typename Target>
+        struct Caster<Target, Base64>
+        {
+            template<typename T>
+            Target operator () (const T& src)
+            {
+                Target result;
+                Into(src, result);
+                return result;
+            }
+
+            //! Replaces the contents of a container of any allocator
+            template<typename T, typename Result>
+            void Into(const T& src, Result& out)
+            {
+                typedef stlencoders::base64<typename CharTraits<typename T::value_type>::type> Codec;
+
+                if (src.empty())
+                {
+                    out.clear();
+                    return;
+                }
+
+                out.resize(Codec::max_decode_size(src.size()));
+                const auto begin = &out[0];
+                out.resize(Codec::decode(src.begin(), src.end(), begin) - begin);
+            }
+        };
+
+        //! Base64 casters for standard containers are compiled into the library
+        extern template struct Caster<Base64, std::string>;
+        extern template struct Caster<Base64, std::vector<char> >;
+        extern template struct Caster<Base64, std::vector<unsigned char> >;
+
+        extern template std::string Caster<std::string, Base64>::operator () (const std::string&);
+        extern template std::vector<char> Caster<std::vector<char>, Base64>::operator () (const std::string&);
+        extern template std::vector<unsigned char> Caster<std::vector<unsigned char>, Base64>::operator () (const std::string&);
+
+        //! Base64 to binary help struct
+        template<>
+        struct Caster<std::vector<char>, std::string>
+        {
+            std::vector<char> operator () (const std::string& src);
+
+            //! Replaces the contents of a container of std::allocator or conv::Allocator
+            template<typename Result>
+            typename boost::enable_if<IsCompiledInto<Result, std::vector<char> > >::type Into(const std::string& src, Result& out);
+        };
+
+        //! Binary to base64 help struct
+        template<>
+        struct Caster<std::string, std::vector<char> >
+        {
+            std::string operator () (const std::vector<char>& src);
+
+            //! Replaces the contents of a string of std::allocator or conv::Allocator
+            template<typename Result>
+            typename boost::enable_if<IsCompiledInto<Result, std::string> >::type Into(const std::vector<char>& src, Result& out);
+        };
+
+        //! Base64 to binary help struct
+        template<>
+        struct Caster<std::vector<unsigned char>, std::string>
+        {
+            std::vector<unsigned char> operator () (const std::string& src);
+
+            //! Replaces the contents of a container of std::allocator or conv::Allocator
+            template<typename Result>
+            typename boost::enable_if<IsCompiledInto<Result, std::vector<unsigned char> > >::type Into(const std::string& src, Result& out);
+        };
+
+        //! Binary to base64 help struct
+        template<>
+        struct Caster<std::string, std::vector<unsigned char> >
+        {
+            std::string operator () (const std::vector<unsigned char>& src);
+
+            //! Replaces the contents of a string of std::allocator or conv::Allocator
+            template<typename Result>
+            typename boost::enable_if<IsCompiledInto<Result, std::string> >::type Into(const std::vector<unsigned char>& src, Result& out);
+        };
+
+        //! Bin to hex help struct
+        template<>
+        struct Caster<Hex, std::vector<char> >
+        {
+            std::string operator () (const std::vector<char>& src);
+
+            //! Replaces the contents of a string of std::allocator or conv::Allocator
+            template<typename Result>
+            typename boost::enable_if<IsCompiledInto<Result, std::string> >::type Into(const std::vector<char>& src, Result& out);
+        };
+
+
+        //! Hex to binary help struct
+        template<>
+        struct Caster<std::vector<char>, Hex>
+        {
+            std::vector<char> operator () (const std::string& src);
+
+            //! Replaces the contents of a container of std::allocator or conv::Allocator
+            template<typename Result>
+            typename boost::enable_if<IsCompiledInto<Result, std::vector<char> > >::type Into(const std::string& src, Result& out);
+        };
+
+        //! Bytes of a string to hex help struct
+        template<>
+        struct Caster<Hex, std::string>
+        {
+            std::string operator () (const std::string& src);
+
+            //! Replaces the contents of a string of std::allocator or conv::Allocator
+            template<typename Result>
+            typename boost::enable_if<IsCompiledInto<Result, std::string> >::type Into(const std::string& src, Result& out);
+        };
+
+        //! Hex to bytes of a string help struct
+        template<>
+        struct Caster<std::string, Hex>
+        {
+            std::string operator () (const std::string& src);
+
+            //! Replaces the contents of a string of std::allocator or conv::Allocator
+            template<typename Result>
+            typename boost::enable_if<IsCompiledInto<Result, std::string> >::type Into(const std::string& src, Result& out);
+        };
+	} // namespace details
+} // namespace conv
+
+#endif // ConversionBinary_h__
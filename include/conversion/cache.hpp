@@ -0,0 +1,193 @@
+#ifndef ConversionCache_h__
+#define ConversionCache_h__
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+#include "conversion/details/caster.hpp"
+
+#include <boost/cstdint.hpp>
+
+namespace conv
+{
+    //! Counters of the cache of one CachedCaster specialization on the calling thread
+    struct CacheStats
+    {
+        boost::uint64_t Hits;
+        boost::uint64_t Misses;
+
+        //! Misses that replaced another entry because its probe window was full
+        boost::uint64_t Evictions;
+    };
+
+	namespace details
+	{
+        //! Key of the object representation, for types without padding
+        template<typename T>
+        struct BytesCacheKey
+        {
+            static bool IsNull(const T&) { return false; }
+            static const char* Data(const T& value) { return reinterpret_cast<const char*>(&value); }
+            static std::size_t Size(const T&) { return sizeof(T); }
+        };
+
+        //! Bytes a cache entry is keyed by, the characters of strings and the representation of numbers
+        //! Other types are specialized where they are known to have no padding, see time.hpp
+        template<typename T>
+        struct CacheKey : BytesCacheKey<T>
+        {
+            static_assert((std::is_arithmetic<T>::value && !std::is_same<T, long double>::value) || std::is_enum<T>::value,
+                "CachedCaster needs a string, number or enum source, structs may have padding and pointers would be keyed by address");
+        };
+
+        //! C strings are keyed by their characters up to the terminator, not by the pointer
+        template<typename Char>
+        struct CacheKey<const Char*>
+        {
+            static_assert(IsCharacter<Char>::value, "CachedCaster needs a string, number or enum source");
+
+            static bool IsNull(const Char* value) { return !value; }
+            static const char* Data(const Char* value) { return reinterpret_cast<const char*>(value); }
+            static std::size_t Size(const Char* value) { return std::char_traits<Char>::length(value) * sizeof(Char); }
+        };
+
+        template<typename Char>
+        struct CacheKey<Char*> : CacheKey<const Char*>
+        {
+        };
+
+        template<typename Char, typename Traits, typename Alloc>
+        struct CacheKey<std::basic_string<Char, Traits, Alloc> >
+        {
+            static bool IsNull(const std::basic_string<Char, Traits, Alloc>&) { return false; }
+            static const char* Data(const std::basic_string<Char, Traits, Alloc>& value) { return reinterpret_cast<const char*>(value.data()); }
+            static std::size_t Size(const std::basic_string<Char, Traits, Alloc>& value) { return value.size() * sizeof(Char); }
+        };
+
+        //! Eight bytes at a time with a multiply and xor-shift per word, the low bits pick the slot so the end is mixed down
+        inline boost::uint64_t HashBytes(const char* data, std::size_t size)
+        {
+            boost::uint64_t hash = size * 0x9E3779B97F4A7C15ull;
+            for (; size >= 8; data += 8, size -= 8)
+            {
+                boost::uint64_t word;
+                std::memcpy(&word, data, 8);
+                hash = (hash ^ word) * 0xBF58476D1CE4E5B9ull;
+                hash ^= hash >> 31;
+            }
+            if (size)
+            {
+                boost::uint64_t word = 0;
+                for (std::size_t i = 0; i < size; ++i)
+                    word |= static_cast<boost::uint64_t>(static_cast<unsigned char>(data[i])) << (i * 8);
+                hash = (hash ^ word) * 0xBF58476D1CE4E5B9ull;
+            }
+            hash = (hash ^ (hash >> 29)) * 0x94D049BB133111EBull;
+            return hash ^ (hash >> 32);
+        }
+	} // namespace details
+
+    //! Caster that remembers its results, for inputs that repeat such as enum names, status codes and keys
+    //! Every thread has its own table of Slots entries per specialization, open addressing with linear probing over
+    //! a window of ProbeLength slots, a full window evicts one of them. Results are returned by value, failed casts
+    //! are not remembered and throw every time. Results must be default constructible
+    template<typename Target, typename Source = std::string, std::size_t Slots = 1024>
+    class CachedCaster
+    {
+        static_assert(Slots && !(Slots & (Slots - 1)), "Slots must be a power of two");
+
+    public:
+        typedef typename details::TypeTraits<Target>::Type Result;
+
+        static const std::size_t ProbeLength = Slots < 8 ? Slots : 8;
+
+        Result operator () (const Source& src) const
+        {
+            typedef details::CacheKey<Source> Key;
+
+            // a null C string would share the key of an empty one
+            if (Key::IsNull(src))
+                return details::stats::Invoke<details::Caster<Target, Source> >(src);
+
+            Table& table = Instance();
+            const char* const data = Key::Data(src);
+            const std::size_t size = Key::Size(src);
+            const boost::uint64_t hash = details::HashBytes(data, size);
+
+            const std::size_t home = static_cast<std::size_t>(hash) & (Slots - 1);
+            Entry* slot = nullptr;
+            for (std::size_t i = 0; i < ProbeLength; ++i)
+            {
+                Entry& entry = table.m_Entries[(home + i) & (Slots - 1)];
+                if (!entry.m_Used)
+                {
+                    slot = &entry;
+                    break;
+                }
+                if (entry.m_Hash == hash && entry.m_Key.size() == size && !std::memcmp(entry.m_Key.data(), data, size))
+                {
+                    ++table.m_Stats.Hits;
+                    return entry.m_Value;
+                }
+            }
+
+            ++table.m_Stats.Misses;
+            Result result = details::stats::Invoke<details::Caster<Target, Source> >(src);
+
+            if (!slot)
+            {
+                // the window is full, victims take turns so a hot entry is not always the one to go
+                slot = &table.m_Entries[(home + table.m_Stats.Evictions % ProbeLength) & (Slots - 1)];
+                ++table.m_Stats.Evictions;
+            }
+            slot->m_Hash = hash;
+            slot->m_Key.assign(data, size);
+            slot->m_Value = result;
+            slot->m_Used = true;
+            return result;
+        }
+
+        //! Counters of the calling thread
+        static CacheStats Stats()
+        {
+            return Instance().m_Stats;
+        }
+
+        //! Forgets the entries and counters of the calling thread, the memory of the keys is kept
+        static void Clear()
+        {
+            Table& table = Instance();
+            for (Entry& entry : table.m_Entries)
+                entry.m_Used = false;
+            table.m_Stats = CacheStats();
+        }
+
+    private:
+        struct Entry
+        {
+            boost::uint64_t m_Hash = 0;
+            bool m_Used = false;
+            std::string m_Key;
+            Result m_Value = Result();
+        };
+
+        struct Table
+        {
+            Entry m_Entries[Slots];
+            CacheStats m_Stats = CacheStats();
+        };
+
+        static Table& Instance()
+        {
+            static thread_local Table table;
+            return table;
+        }
+    };
+
+    template<typename Target, typename Source, std::size_t Slots>
+    const std::size_t CachedCaster<Target, Source, Slots>::ProbeLength;
+} // namespace conv
+
+#endif // ConversionCache_h__
@@ -0,0 +1,258 @@
+#ifndef ConversionChrono_h__
+#define ConversionChrono_h__
+
+#include <chrono>
+#include <limits>
+#include <string>
+#include <type_traits>
+
+#include "conversion/epoch.hpp"
+#include "conversion/numeric.hpp"
+#include "conversion/details/civil.hpp"
+
+#include <boost/cstdint.hpp>
+
+namespace conv
+{
+	namespace details
+	{
+        //! Number of decimal digits in the power of ten, -1 for other values
+        constexpr int PowerOfTenDigits(const boost::int64_t value, const int digits = 0)
+        {
+            return value == 1 ? digits : value % 10 ? -1 : PowerOfTenDigits(value / 10, digits + 1);
+        }
+
+        //! Text form of std::chrono durations, in ticks of seconds or finer
+        template<typename Duration>
+        struct ChronoTraits
+        {
+            //! Coarser durations than seconds are written and read in seconds
+            typedef typename std::common_type<Duration, std::chrono::seconds>::type Exact;
+            typedef typename Exact::rep Rep;
+            typedef typename Exact::period Period;
+
+            static_assert(std::is_integral<Rep>::value && std::is_signed<Rep>::value, "signed integral duration representation expected");
+            static_assert(Period::num == 1 && Period::den <= 1000000000, "duration of seconds or finer, down to nanoseconds, expected");
+
+            static const boost::int64_t PerSecond = Period::den;
+
+            //! Fraction digits, nanoseconds when ticks per second is not a power of ten
+            static const int Digits = PowerOfTenDigits(PerSecond) < 0 ? 9 : PowerOfTenDigits(PerSecond);
+
+            //! Ticks within a second as Digits decimal digits
+            static boost::int64_t Fraction(const boost::int64_t ticks)
+            {
+                return PowerOfTenDigits(PerSecond) < 0 ? ticks * 1000000000 / PerSecond : ticks;
+            }
+
+            //! Count of seconds and nanoseconds, throws if it does not fit the representation
+            static Rep Join(const boost::int64_t seconds, const boost::int64_t nanoseconds)
+            {
+                const boost::int64_t max = static_cast<boost::int64_t>(std::numeric_limits<Rep>::max() / PerSecond) - 1;
+                if (seconds > max || seconds < -max)
+                    ThrowCast<std::string>();
+                return static_cast<Rep>(seconds * PerSecond + nanoseconds * PerSecond / 1000000000);
+            }
+
+            //! Rounds toward negative infinity, the parsed text may be finer than the duration
+            static Duration FromExact(const Exact& exact)
+            {
+                const Duration result = std::chrono::duration_cast<Duration>(exact);
+                return result > exact ? result - Duration(1) : result;
+            }
+
+            //! Writes the fraction with a leading dot, nothing when it is zero
+            template<typename Char>
+            static Char* WriteFraction(const boost::int64_t ticks, Char* out)
+            {
+                if (!ticks)
+                    return out;
+                *out++ = Char('.');
+                return integer::WriteFixed(Fraction(ticks), Digits, out);
+            }
+        };
+
+        //! Time point to count of Unit since epoch, truncated toward zero as for posix time
+        template<typename Count, typename Unit, typename Duration>
+        struct ChronoToEpoch
+        {
+            Count operator () (const std::chrono::time_point<std::chrono::system_clock, Duration>& src)
+            {
+                return static_cast<Count>(std::chrono::duration_cast<Unit>(src.time_since_epoch()).count());
+            }
+        };
+
+        //! Count of Unit since epoch to time point
+        template<typename Count, typename Unit, typename Duration>
+        struct EpochToChrono
+        {
+            std::chrono::time_point<std::chrono::system_clock, Duration> operator () (const Count& src)
+            {
+                typedef typename Unit::rep Rep;
+                return std::chrono::time_point<std::chrono::system_clock, Duration>(std::chrono::duration_cast<Duration>(Unit(static_cast<Rep>(src))));
+            }
+        };
+
+        //! Specialized help struct - conversion system clock time point to string, YYYY-MM-DDTHH:MM:SS[.fraction]
+        template<typename Duration>
+        struct Caster<std::string, std::chrono::time_point<std::chrono::system_clock, Duration> >
+        {
+            std::string operator () (const std::chrono::time_point<std::chrono::system_clock, Duration>& src)
+            {
+                std::string result;
+                Into(src, result);
+                return result;
+            }
+
+            //! Replaces the contents of a string of any allocator
+            template<typename Result>
+            void Into(const std::chrono::time_point<std::chrono::system_clock, Duration>& src, Result& out)
+            {
+                typedef ChronoTraits<Duration> Traits;
+
+                const boost::int64_t count = typename Traits::Exact(src.time_since_epoch()).count();
+                const boost::int64_t seconds = civil::FloorDiv(count, Traits::PerSecond);
+                const boost::int64_t days = civil::FloorDiv(seconds, civil::SecondsPerDay);
+                const civil::Date date = civil::CivilFromDays(days);
+                if (date.m_Year < 0 || date.m_Year > 9999)
+                    ThrowCast<std::chrono::time_point<std::chrono::system_clock, Duration> >();
+
+                char buffer[32];
+                char* end = civil::WriteDateTime(date, seconds - days * civil::SecondsPerDay, buffer);
+                end = Traits::WriteFraction(count - seconds * Traits::PerSecond, end);
+                out.assign(buffer, end);
+            }
+        };
+
+        //! Specialized help struct - conversion string to system clock time point, fraction digits past the duration are truncated
+        template<typename Duration>
+        struct Caster<std::chrono::time_point<std::chrono::system_clock, Duration>, std::string>
+        {
+            std::chrono::time_point<std::chrono::system_clock, Duration> operator () (const std::string& src)
+            {
+                typedef ChronoTraits<Duration> Traits;
+
+                const char* const begin = src.data();
+                const char* const end = begin + src.size();
+
+                boost::int64_t seconds, nanoseconds;
+                if (src.size() < civil::DateTimeLength || !civil::ReadDateTime(begin, seconds) ||
+                    !civil::ReadTail(begin + civil::DateTimeLength, end, true, nanoseconds))
+                    ThrowCast<std::string>();
+
+                const typename Traits::Exact since(Traits::Join(seconds, nanoseconds));
+                return std::chrono::time_point<std::chrono::system_clock, Duration>(Traits::FromExact(since));
+            }
+        };
+
+        //! Specialized help struct - conversion system clock time point to milliseconds since epoch
+        template<typename Duration>
+        struct Caster<boost::uint64_t, std::chrono::time_point<std::chrono::system_clock, Duration> >
+            : ChronoToEpoch<boost::uint64_t, std::chrono::milliseconds, Duration>
+        {
+        };
+
+        //! Specialized help struct - conversion system clock time point to seconds since epoch
+        template<typename Duration>
+        struct Caster<boost::uint32_t, std::chrono::time_point<std::chrono::system_clock, Duration> >
+            : ChronoToEpoch<boost::uint32_t, std::chrono::seconds, Duration>
+        {
+        };
+
+        //! Specialized help struct - conversion system clock time point to microseconds since epoch
+        template<typename Duration>
+        struct Caster<EpochMicroseconds, std::chrono::time_point<std::chrono::system_clock, Duration> >
+            : ChronoToEpoch<boost::uint64_t, std::chrono::microseconds, Duration>
+        {
+        };
+
+        //! Specialized help struct - conversion system clock time point to nanoseconds since epoch
+        template<typename Duration>
+        struct Caster<EpochNanoseconds, std::chrono::time_point<std::chrono::system_clock, Duration> >
+            : ChronoToEpoch<boost::uint64_t, std::chrono::nanoseconds, Duration>
+        {
+        };
+
+        //! Specialized help struct - conversion milliseconds since epoch to system clock time point
+        template<typename Duration>
+        struct Caster<std::chrono::time_point<std::chrono::system_clock, Duration>, boost::uint64_t>
+            : EpochToChrono<boost::uint64_t, std::chrono::milliseconds, Duration>
+        {
+        };
+
+        //! Specialized help struct - conversion seconds since epoch to system clock time point
+        template<typename Duration>
+        struct Caster<std::chrono::time_point<std::chrono::system_clock, Duration>, boost::uint32_t>
+            : EpochToChrono<boost::uint32_t, std::chrono::seconds, Duration>
+        {
+        };
+
+        //! Specialized help struct - conversion microseconds since epoch to system clock time point
+        template<typename Duration>
+        struct Caster<std::chrono::time_point<std::chrono::system_clock, Duration>, EpochMicroseconds>
+            : EpochToChrono<boost::uint64_t, std::chrono::microseconds, Duration>
+        {
+        };
+
+        //! Specialized help struct - conversion nanoseconds since epoch to system clock time point
+        template<typename Duration>
+        struct Caster<std::chrono::time_point<std::chrono::system_clock, Duration>, EpochNanoseconds>
+            : EpochToChrono<boost::uint64_t, std::chrono::nanoseconds, Duration>
+        {
+        };
+
+        //! Specialized help struct - conversion duration to string, [-]HH:MM:SS[.fraction] with hours not wrapped at a day
+        template<typename Rep, typename Period>
+        struct Caster<std::string, std::chrono::duration<Rep, Period> >
+        {
+            std::string operator () (const std::chrono::duration<Rep, Period>& src)
+            {
+                std::string result;
+                Into(src, result);
+                return result;
+            }
+
+            //! Replaces the contents of a string of any allocator
+            template<typename Result>
+            void Into(const std::chrono::duration<Rep, Period>& src, Result& out)
+            {
+                typedef ChronoTraits<std::chrono::duration<Rep, Period> > Traits;
+
+                const boost::int64_t count = typename Traits::Exact(src).count();
+                const boost::uint64_t ticks = count < 0 ? 0 - static_cast<boost::uint64_t>(count) : static_cast<boost::uint64_t>(count);
+                const boost::uint64_t seconds = ticks / Traits::PerSecond;
+
+                char buffer[48];
+                char* end = buffer;
+                if (count < 0)
+                    *end++ = '-';
+                end = civil::WriteClock(seconds, end);
+                end = Traits::WriteFraction(static_cast<boost::int64_t>(ticks % Traits::PerSecond), end);
+                out.assign(buffer, end);
+            }
+        };
+
+        //! Specialized help struct - conversion string to duration
+        template<typename Rep, typename Period>
+        struct Caster<std::chrono::duration<Rep, Period>, std::string>
+        {
+            std::chrono::duration<Rep, Period> operator () (const std::string& src)
+            {
+                typedef ChronoTraits<std::chrono::duration<Rep, Period> > Traits;
+
+                const char* in = src.data();
+                const char* const end = in + src.size();
+
+                bool negative;
+                boost::int64_t seconds, nanoseconds;
+                if (!civil::ReadClock(in, end, negative, seconds) || !civil::ReadTail(in, end, false, nanoseconds))
+                    ThrowCast<std::string>();
+
+                const typename Traits::Rep count = Traits::Join(seconds, nanoseconds);
+                return Traits::FromExact(typename Traits::Exact(negative ? -count : count));
+            }
+        };
+	} // namespace details
+} // namespace conv
+
+#endif // ConversionChrono_h__
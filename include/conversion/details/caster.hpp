@@ -0,0 +1,623 @@
+#ifndef ConversionCaster_h__
+#define ConversionCaster_h__
+
+#include <cmath>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+#include "conversion/details/forward.hpp"
+#include "conversion/details/integer.hpp"
+#include "conversion/details/stats.hpp"
+
+#include <boost/lexical_cast.hpp>
+#include <boost/type_traits/is_enum.hpp>
+#include <boost/utility/enable_if.hpp>
+#include <boost/type_traits/remove_cv.hpp>
+#include <boost/mpl/or.hpp>
+#include <boost/mpl/and.hpp>
+#include <boost/mpl/not.hpp>
+#include <boost/type_traits/is_arithmetic.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <boost/config.hpp>
+#include <boost/exception/exception.hpp>
+#include <boost/lexical_cast/try_lexical_convert.hpp>
+
+namespace conv
+{
+    struct CastException : virtual boost::exception, std::exception { };
+
+	namespace details
+	{
+        //! Type traits
+        template<typename T>
+        struct TypeTraits
+        {
+            typedef T Type;
+        };
+
+		//! Customized stream type for boolean
+		struct Boolean 
+		{
+			bool m_Data;
+			Boolean() {}
+			Boolean(bool data) : m_Data(data) {}
+			operator bool() const { return m_Data; }
+
+			template<typename T>
+			friend std::basic_ostream<T>& operator << (std::basic_ostream<T>& out, const Boolean& b) 
+			{
+				out << std::boolalpha << b.m_Data;
+				return out;
+			}
+
+			template<typename T>
+			friend std::basic_istream<T> & operator >> (std::basic_istream<T>& in, Boolean& b) 
+			{
+				in >> std::boolalpha >> b.m_Data;
+				if (in.fail())
+				{
+					in.unsetf(std::ios_base::boolalpha);
+					in.clear();
+					in >> b.m_Data;
+				}
+				return in;
+			}
+		};
+
+//! Error paths are kept out of line, away from the conversion code
+#if defined(__GNUC__) || defined(__clang__)
+#define CONVERSION_COLD __attribute__((cold, noinline))
+#else
+#define CONVERSION_COLD BOOST_NOINLINE
+#endif
+
+        //! Throws CastException with the source type name
+        BOOST_NORETURN CONVERSION_COLD void ThrowCast(const std::type_info& source);
+
+        //! Throws CastException with the source type name and the nested bad_lexical_cast
+        BOOST_NORETURN CONVERSION_COLD void ThrowLexicalCast(const std::type_info& source, const std::type_info& target);
+
+        template<typename Source>
+        BOOST_NORETURN inline void ThrowCast()
+        {
+            ThrowCast(typeid(Source));
+        }
+
+        //! Value type of numeric type, enums are represented by their underlying type
+        template<typename T, bool = boost::is_enum<T>::value>
+        struct NumericValue
+        {
+            typedef T Type;
+            typedef decltype(+std::declval<T>()) Promoted;
+        };
+
+        template<typename T>
+        struct NumericValue<T, true> : NumericValue<typename std::underlying_type<T>::type>
+        {
+        };
+
+        //! Integral from integral, the value must survive the round trip and keep its sign
+        template<typename To, typename From>
+        bool IsRepresentable(const From value, boost::true_type, boost::true_type)
+        {
+            const To result = static_cast<To>(value);
+            return static_cast<From>(result) == value && (result < To()) == (value < From());
+        }
+
+        //! Integral from floating point, the value must be integral and in range
+        template<typename To, typename From>
+        bool IsRepresentable(const From value, boost::true_type, boost::false_type)
+        {
+            typedef std::numeric_limits<To> Limits;
+            const From upper = std::ldexp(From(1), Limits::digits);
+            const From lower = Limits::is_signed ? -upper : From();
+            return value >= lower && value < upper && std::trunc(value) == value;
+        }
+
+        //! Floating point from integral, always in range
+        template<typename To, typename From>
+        bool IsRepresentable(const From, boost::false_type, boost::true_type)
+        {
+            return true;
+        }
+
+        //! Floating point from floating point, finite values must be in range
+        template<typename To, typename From>
+        bool IsRepresentable(const From value, boost::false_type, boost::false_type)
+        {
+            const To max = std::numeric_limits<To>::max();
+            return std::isinf(value) || !(value < -max || value > max);
+        }
+
+        //! Checked narrowing conversion between arithmetic and enum types
+        template<typename Target, typename Source>
+        Target NumericCast(const Source src)
+        {
+            typedef typename NumericValue<Target>::Type To;
+            typedef typename NumericValue<Source>::Type From;
+
+            const From value = static_cast<From>(src);
+            if (!IsRepresentable<To>(value, boost::is_integral<To>(), boost::is_integral<From>()))
+                ThrowCast<Source>();
+
+            return static_cast<Target>(static_cast<To>(value));
+        }
+
+        //! Character types keep the lexical_cast semantics
+        template<typename T>
+        struct IsCharacter : boost::mpl::or_
+        <
+            boost::mpl::or_<boost::is_same<T, char>, boost::is_same<T, signed char>, boost::is_same<T, unsigned char> >,
+            boost::is_same<T, wchar_t>,
+            boost::is_same<T, char16_t>,
+            boost::is_same<T, char32_t>
+        >
+        {
+        };
+
+        //! Arithmetic types and enums are converted without streams, characters are not numbers here
+        template<typename T>
+        struct IsNumeric : boost::mpl::and_<boost::mpl::or_<boost::is_arithmetic<T>, boost::is_enum<T> >, boost::mpl::not_<IsCharacter<T> > >
+        {
+        };
+
+        template<typename Target, typename Source>
+        struct IsNumericPair : boost::mpl::and_<IsNumeric<Target>, IsNumeric<Source>, boost::mpl::not_<boost::is_same<Target, Source> > >
+        {
+        };
+
+        //! Integers are formatted and parsed without streams
+        template<typename T>
+        struct IsInteger : boost::mpl::and_<boost::is_integral<T>, boost::mpl::not_<boost::is_same<T, bool> >, boost::mpl::not_<IsCharacter<T> > >
+        {
+        };
+
+        //! Narrow and wide strings, with their character range
+        template<typename T>
+        struct StringTraits
+        {
+            static const bool Value = false;
+        };
+
+        template<typename Char>
+        struct StringTraits<std::basic_string<Char> >
+        {
+            static const bool Value = true;
+            static bool IsNull(const std::basic_string<Char>&) { return false; }
+            static const Char* Begin(const std::basic_string<Char>& s) { return s.data(); }
+            static const Char* End(const std::basic_string<Char>& s) { return s.data() + s.size(); }
+        };
+
+        template<typename Char>
+        struct StringTraits<const Char*>
+        {
+            static const bool Value = true;
+            static bool IsNull(const Char* s) { return !s; }
+            static const Char* Begin(const Char* s) { return s; }
+            static const Char* End(const Char* s) { return s + std::char_traits<Char>::length(s); }
+        };
+
+        template<typename Char>
+        struct StringTraits<Char*> : StringTraits<const Char*>
+        {
+        };
+
+        template<typename T>
+        struct IsString : boost::integral_constant<bool, StringTraits<T>::Value>
+        {
+        };
+
+        template<typename T>
+        struct IsStringObject : boost::false_type
+        {
+        };
+
+        template<typename Char>
+        struct IsStringObject<std::basic_string<Char> > : boost::true_type
+        {
+        };
+
+        template<typename Target, typename Source>
+        struct IsIntegerFormat : boost::mpl::and_<IsInteger<Source>, IsStringObject<Target> >
+        {
+        };
+
+        template<typename Target, typename Source>
+        struct IsIntegerParse : boost::mpl::and_<IsInteger<Target>, IsString<Source> >
+        {
+        };
+
+        //! Expression check helper of the customization points
+        template<typename... T>
+        struct VoidType
+        {
+            typedef void Type;
+        };
+
+        //! Types with conv_to_chars(buffer, value) found by ADL, it appends the text of value to the empty string buffer
+        template<typename T, typename Buffer, typename = void>
+        struct HasToChars : boost::false_type
+        {
+        };
+
+        template<typename T, typename Buffer>
+        struct HasToChars<T, Buffer, typename VoidType<decltype(conv_to_chars(std::declval<Buffer&>(), std::declval<const T&>()))>::Type> : boost::true_type
+        {
+        };
+
+        //! Types with conv_from_chars(first, last, value) found by ADL, it reads [first, last) into value and returns false on bad input
+        template<typename T, typename Source, typename = void>
+        struct HasFromChars : boost::false_type
+        {
+        };
+
+        template<typename T, typename Source>
+        struct HasFromChars<T, Source, typename VoidType<decltype(conv_from_chars(StringTraits<Source>::Begin(std::declval<const Source&>()), StringTraits<Source>::End(std::declval<const Source&>()), std::declval<T&>()))>::Type> : boost::true_type
+        {
+        };
+
+        template<typename Target, typename Source>
+        struct IsUserFormat : boost::mpl::and_<IsStringObject<Target>, HasToChars<Source, Target> >
+        {
+        };
+
+        template<typename Target, typename Source>
+        struct IsUserParse : boost::mpl::and_<IsString<Source>, HasFromChars<Target, Source> >
+        {
+        };
+
+        template<typename Target, typename Source>
+		typename boost::enable_if
+		<
+			boost::is_same<Target, Source>,
+			Target
+		>::type CastImpl(const Source& src)
+		{
+            return src;
+		}
+
+		template<typename Target, typename Source>
+		typename boost::disable_if
+		<
+			boost::mpl::or_<boost::mpl::or_<boost::is_enum<Target>, boost::is_enum<Source> >, boost::is_same<Target, Source>, IsNumericPair<Target, Source>, boost::mpl::or_<IsIntegerFormat<Target, Source>, IsIntegerParse<Target, Source> >, boost::mpl::or_<IsUserFormat<Target, Source>, IsUserParse<Target, Source> > >,
+			Target
+		>::type CastImpl(const Source& src)
+		{
+            typedef typename boost::remove_cv<Target>::type Result;
+
+            Result result;
+            if (!boost::conversion::try_lexical_convert(src, result))
+                ThrowLexicalCast(typeid(Source), typeid(Result));
+            return result;
+		}
+
+        template<typename Target, typename Source>
+        typename boost::enable_if
+        <
+            IsNumericPair<Target, Source>,
+            Target
+        >::type CastImpl(const Source& src)
+        {
+            return NumericCast<typename boost::remove_cv<Target>::type>(src);
+        }
+
+        template<typename Target, typename Source>
+        typename boost::enable_if
+        <
+            IsIntegerFormat<Target, Source>,
+            Target
+        >::type CastImpl(const Source& src)
+        {
+            return integer::ToString<Target>(src);
+        }
+
+        template<typename Target, typename Source>
+        typename boost::enable_if
+        <
+            IsIntegerParse<Target, Source>,
+            Target
+        >::type CastImpl(const Source& src)
+        {
+            typedef StringTraits<Source> Traits;
+
+            Target result = Target();
+            if (Traits::IsNull(src) || !integer::Parse(Traits::Begin(src), Traits::End(src), result))
+                ThrowCast<Source>();
+            return result;
+        }
+
+        //! User types with conv_to_chars, no streams involved
+        template<typename Target, typename Source>
+        typename boost::enable_if
+        <
+            IsUserFormat<Target, Source>,
+            Target
+        >::type CastImpl(const Source& src)
+        {
+            Target result;
+            conv_to_chars(result, src);
+            return result;
+        }
+
+        //! User types with conv_from_chars
+        template<typename Target, typename Source>
+        typename boost::enable_if
+        <
+            IsUserParse<Target, Source>,
+            Target
+        >::type CastImpl(const Source& src)
+        {
+            typedef StringTraits<Source> Traits;
+
+            Target result = Target();
+            if (Traits::IsNull(src) || !conv_from_chars(Traits::Begin(src), Traits::End(src), result))
+                ThrowCast<Source>();
+            return result;
+        }
+
+		template<typename Target, typename Source>
+		typename boost::enable_if
+		<
+			boost::mpl::and_<boost::is_enum<Target>, boost::mpl::not_<IsNumeric<Source> >, boost::mpl::not_<IsUserParse<Target, Source> > >,
+			Target
+		>::type CastImpl(const Source& src)
+		{
+            typedef typename NumericValue<Target>::Promoted Value;
+            return NumericCast<typename boost::remove_cv<Target>::type>(CastImpl<Value, Source>(src));
+        }
+
+        template<typename Target, typename Source>
+		typename boost::enable_if
+		<
+			 boost::mpl::and_<boost::is_enum<Source>, boost::mpl::not_<IsNumeric<Target> >, boost::mpl::not_<IsUserFormat<Target, Source> > >,
+			 Target
+		>::type CastImpl(const Source& src)
+		{
+            typedef typename NumericValue<Source>::Promoted Value;
+            return CastImpl<typename boost::remove_cv<Target>::type, Value>(static_cast<Value>(src));
+        }
+
+		//! Help template struct
+		template<typename Target, typename Source>
+		struct Caster
+		{
+            Target operator () (const Source& src)
+			{
+				return CastImpl<Target, Source>(src);
+			}
+
+            //! Integers replace the contents of a string of any allocator without a temporary
+            template<typename Result, typename T = Target>
+            typename boost::enable_if<IsIntegerFormat<T, Source> >::type Into(const Source& src, Result& out)
+            {
+                typedef typename Result::value_type Char;
+
+                Char buffer[std::numeric_limits<Source>::digits10 + 2];
+                Char* const end = buffer + sizeof(buffer) / sizeof(Char);
+                out.assign(integer::Format(src, end), end);
+            }
+
+            //! User types append to the string itself, so it keeps its capacity
+            template<typename Result, typename T = Target>
+            typename boost::enable_if<boost::mpl::and_<IsUserFormat<T, Source>, HasToChars<Source, Result> > >::type Into(const Source& src, Result& out)
+            {
+                out.clear();
+                conv_to_chars(out, src);
+            }
+		};
+
+        //! Copies a result of the same type, the copy reuses the capacity of out
+        template<typename T>
+        void Assign(T& out, const T& value)
+        {
+            out = value;
+        }
+
+        //! Copies a result into a container of another allocator, element by element when they are containers as well
+        template<typename Result, typename Value>
+        typename boost::enable_if<std::is_constructible<typename Result::value_type, const typename Value::value_type&> >::type AssignItems(Result& out, const Value& value)
+        {
+            out.assign(value.begin(), value.end());
+        }
+
+        template<typename Result, typename Value>
+        typename boost::disable_if<std::is_constructible<typename Result::value_type, const typename Value::value_type&> >::type AssignItems(Result& out, const Value& value)
+        {
+            out.clear();
+            out.reserve(value.size());
+            for (const auto& item : value)
+                out.emplace_back(item.begin(), item.end());
+        }
+
+        template<typename Result, typename Value>
+        typename boost::disable_if<boost::is_same<Result, Value> >::type Assign(Result& out, const Value& value)
+        {
+            AssignItems(out, value);
+        }
+
+        //! Empties containers, other targets are overwritten as a whole
+        template<typename T>
+        auto Clear(T& target, int) -> decltype(target.clear())
+        {
+            target.clear();
+        }
+
+        template<typename T>
+        void Clear(T&, long)
+        {
+        }
+
+        //! Element of a container taken over by Allocator, strings get it as well
+        template<typename T>
+        struct AllocatedElement
+        {
+            typedef T Type;
+        };
+
+        template<typename Char, typename Traits, typename Alloc>
+        struct AllocatedElement<std::basic_string<Char, Traits, Alloc> >
+        {
+            typedef std::basic_string<Char, Traits, Allocator<Char> > Type;
+        };
+
+        //! Result type of the casts with Allocator, only containers have one
+        template<typename T>
+        struct Allocated
+        {
+        };
+
+        template<typename Char, typename Traits, typename Alloc>
+        struct Allocated<std::basic_string<Char, Traits, Alloc> > : AllocatedElement<std::basic_string<Char, Traits, Alloc> >
+        {
+        };
+
+        template<typename T, typename Alloc>
+        struct Allocated<std::vector<T, Alloc> >
+        {
+            typedef std::vector<typename AllocatedElement<T>::Type, Allocator<typename AllocatedElement<T>::Type> > Type;
+        };
+
+        //! Whether Result is one the Into members compiled in the library are instantiated for, T itself or T in memory of
+        //! Allocator. Other results, such as strings of another allocator, go through Assign(out, caster(src))
+        template<typename Result, typename T>
+        struct IsCompiledInto : boost::mpl::or_<boost::is_same<Result, T>, boost::is_same<Result, typename Allocated<T>::Type> >
+        {
+        };
+
+        //! Replaces the contents of out with the result, casters with an Into member write it directly
+        template<typename Caster, typename Source, typename Result>
+        auto WriteInto(Caster& caster, const Source& src, Result& out) -> decltype(caster.Into(src, out))
+        {
+            return caster.Into(src, out);
+        }
+
+        //! The other casters produce the result first
+        template<typename Caster, typename Source, typename Result, typename... Ignored>
+        void WriteInto(Caster& caster, const Source& src, Result& out, Ignored...)
+        {
+            Assign(out, caster(src));
+        }
+
+        template<typename Caster, typename Result, typename Source>
+        void CastInto(Result& target, const Source& value)
+        {
+            try
+            {
+                stats::InvokeInto<Caster>(value, target);
+            }
+            catch (...)
+            {
+                Clear(target, 0);
+                throw;
+            }
+        }
+	} // namespace details
+
+    //! Cast function
+    template<typename Target, typename Source>
+    inline typename details::TypeTraits<Target>::Type cast(const Source& value)
+    {
+        return details::stats::Invoke<details::Caster<Target, Source> >(value);
+    }
+
+    //! Cast function
+    template<typename Target, typename From, typename Source>
+    inline typename details::TypeTraits<Target>::Type cast(const Source& value)
+    {
+        return details::stats::Invoke<details::Caster<Target, From> >(value);
+    }
+
+    //! Cast function for const strings
+    template<typename Target, typename Source, size_t N>
+    inline typename details::TypeTraits<Target>::Type cast(const Source (&value)[N])
+    {
+        typedef std::basic_string<Source> SourceString;
+        return details::stats::Invoke<details::Caster<Target, SourceString> >(SourceString(value, N - 1));
+    }
+
+    //! Cast function
+    template<typename Target, typename Source>
+    inline typename details::TypeTraits<Target>::Type cast(const Source& value, const Target& def)
+    {
+        try
+        {
+            return details::stats::Invoke<details::Caster<Target, Source> >(value);
+        }
+        catch (const CastException&)
+        {
+            return def;
+        }
+    }
+
+    //! Cast function
+    template<typename Target, typename From, typename Source>
+    inline typename details::TypeTraits<Target>::Type cast(const Source& value, const Target& def)
+    {
+        try
+        {
+            return details::stats::Invoke<details::Caster<Target, From> >(value);
+        }
+        catch (const CastException&)
+        {
+            return def;
+        }
+
+    }
+
+    //! Cast function for const strings
+    template<typename Target, typename Source, size_t N>
+    inline typename details::TypeTraits<Target>::Type cast(const Source(&value)[N], const Target& def)
+    {
+        try
+        {
+            typedef std::basic_string<Source> SourceString;
+            return details::stats::Invoke<details::Caster<Target, SourceString> >(SourceString(value, N - 1));
+        }
+        catch (const CastException&)
+        {
+            return def;
+        }
+    }
+
+    //! Cast function writing into target, a string or vector keeps its capacity so a loop that reuses it stops allocating
+    //! The target is left empty when the cast throws
+    template<typename Result, typename Source>
+    inline void cast_into(Result& target, const Source& value)
+    {
+        details::CastInto<details::Caster<Result, Source> >(target, value);
+    }
+
+    //! Cast function writing into target, with a tag such as Base64 or an explicit target type
+    template<typename Target, typename Result, typename Source>
+    inline typename boost::disable_if<boost::is_same<Target, Result> >::type cast_into(Result& target, const Source& value)
+    {
+        details::CastInto<details::Caster<Target, Source> >(target, value);
+    }
+
+    //! Cast function writing into target
+    template<typename Target, typename From, typename Result, typename Source>
+    inline void cast_into(Result& target, const Source& value)
+    {
+        details::CastInto<details::Caster<Target, From> >(target, value);
+    }
+
+    //! Batch cast function, converts [first, last) into out for casters that provide a Batch form
+    template<typename Target, typename Source, typename Result>
+    inline void cast(const Source* first, const Source* last, Result* out)
+    {
+        details::Caster<Target, Source>::Batch(first, last, out);
+    }
+
+    //! Batch cast function
+    template<typename Target, typename From, typename Source, typename Result>
+    inline void cast(const Source* first, const Source* last, Result* out)
+    {
+        details::Caster<Target, From>::Batch(first, last, out);
+    }
+} // namespace conv
+
+#endif // ConversionCaster_h__
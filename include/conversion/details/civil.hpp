@@ -0,0 +1,286 @@
+#ifndef Civil_h__
+#define Civil_h__
+
+#include <boost/cstdint.hpp>
+
+#include "conversion/details/integer.hpp"
+
+namespace conv
+{
+namespace details
+{
+namespace civil
+{
+    const boost::int64_t SecondsPerDay = 86400;
+
+    //! Division rounding toward negative infinity, divisor is positive
+    inline boost::int64_t FloorDiv(const boost::int64_t value, const boost::int64_t divisor)
+    {
+        return value / divisor - (value % divisor < 0 ? 1 : 0);
+    }
+
+    //! Proleptic gregorian calendar date
+    struct Date
+    {
+        boost::int64_t m_Year;
+        unsigned m_Month;
+        unsigned m_Day;
+    };
+
+    constexpr bool IsLeap(const boost::int64_t year)
+    {
+        return year % 4 == 0 && (year % 100 != 0 || year % 400 == 0);
+    }
+
+    inline unsigned DaysInMonth(const boost::int64_t year, const unsigned month)
+    {
+        static const unsigned char days[] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+        return month == 2 && IsLeap(year) ? 29 : days[month - 1];
+    }
+
+    //! Days since 1970-01-01, counted in 400 year eras starting at March 1 so the leap day is the last of the year
+    constexpr boost::int64_t DaysFromCivil(const Date& date)
+    {
+        const boost::int64_t year = date.m_Year - (date.m_Month <= 2 ? 1 : 0);
+        const boost::int64_t era = (year >= 0 ? year : year - 399) / 400;
+        const unsigned yearOfEra = static_cast<unsigned>(year - era * 400);
+        const unsigned dayOfYear = (153 * (date.m_Month > 2 ? date.m_Month - 3 : date.m_Month + 9) + 2) / 5 + date.m_Day - 1;
+        const unsigned dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+        return era * 146097 + dayOfEra - 719468;
+    }
+
+    //! Inverse of DaysFromCivil
+    inline Date CivilFromDays(const boost::int64_t days)
+    {
+        const boost::int64_t shifted = days + 719468;
+        const boost::int64_t era = (shifted >= 0 ? shifted : shifted - 146096) / 146097;
+        const unsigned dayOfEra = static_cast<unsigned>(shifted - era * 146097);
+        const unsigned yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+        const unsigned dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+        const unsigned monthIndex = (5 * dayOfYear + 2) / 153;
+
+        Date date;
+        date.m_Day = dayOfYear - (153 * monthIndex + 2) / 5 + 1;
+        date.m_Month = monthIndex < 10 ? monthIndex + 3 : monthIndex - 9;
+        date.m_Year = yearOfEra + era * 400 + (date.m_Month <= 2 ? 1 : 0);
+        return date;
+    }
+
+    //! Writes YYYY-MM-DD, year must be in [0, 9999]
+    template<typename Char>
+    Char* WriteDate(const Date& date, Char* out)
+    {
+        out = integer::WriteFixed(static_cast<unsigned>(date.m_Year), 4, out);
+        *out++ = Char('-');
+        out = integer::WriteFixed(date.m_Month, 2, out);
+        *out++ = Char('-');
+        return integer::WriteFixed(date.m_Day, 2, out);
+    }
+
+    //! Writes HH:MM:SS, hours are not wrapped at a day and take as many digits as needed
+    template<typename Char>
+    Char* WriteClock(const boost::uint64_t seconds, Char* out)
+    {
+        Char hours[24];
+        Char* const end = hours + sizeof(hours) / sizeof(Char);
+        const Char* const first = integer::Format(seconds / 3600, end);
+        if (end - first < 2)
+            *out++ = Char('0');
+        for (const Char* digit = first; digit != end; ++digit)
+            *out++ = *digit;
+        *out++ = Char(':');
+        out = integer::WriteFixed(static_cast<unsigned>(seconds / 60 % 60), 2, out);
+        *out++ = Char(':');
+        return integer::WriteFixed(static_cast<unsigned>(seconds % 60), 2, out);
+    }
+
+    //! Writes YYYY-MM-DDTHH:MM:SS, year must be in [0, 9999]
+    template<typename Char>
+    Char* WriteDateTime(const Date& date, const boost::int64_t secondsOfDay, Char* out)
+    {
+        out = WriteDate(date, out);
+        *out++ = Char('T');
+        return WriteClock(static_cast<boost::uint64_t>(secondsOfDay), out);
+    }
+
+    //! Length of YYYY-MM-DD
+    const int DateLength = 10;
+
+    //! Length of YYYY-MM-DDTHH
+    const int DateHourLength = 13;
+
+    //! Length of YYYY-MM-DDTHH:MM:SS
+    const int DateTimeLength = 19;
+
+    //! Reads YYYY-MM-DD as days since epoch, input must hold DateLength characters
+    template<typename Char>
+    bool ReadDate(const Char* in, boost::int64_t& days)
+    {
+        unsigned year, month, day;
+        if (!integer::ReadFixed(in, 4, year) || in[4] != Char('-') ||
+            !integer::ReadFixed(in + 5, 2, month) || in[7] != Char('-') ||
+            !integer::ReadFixed(in + 8, 2, day))
+            return false;
+
+        if (month < 1 || month > 12 || day < 1 || day > DaysInMonth(year, month))
+            return false;
+
+        const Date date = { year, month, day };
+        days = DaysFromCivil(date);
+        return true;
+    }
+
+    //! Reads YYYY-MM-DDTHH as seconds since epoch, input must hold DateHourLength characters
+    //! RFC 3339 also allows 't' or a space as the separator
+    template<typename Char>
+    bool ReadDateHour(const Char* in, boost::int64_t& seconds, const bool rfc3339 = false)
+    {
+        const Char separator = in[DateLength];
+        const bool time = separator == Char('T') || (rfc3339 && (separator == Char('t') || separator == Char(' ')));
+
+        boost::int64_t days;
+        unsigned hours;
+        if (!ReadDate(in, days) || !time || !integer::ReadFixed(in + DateLength + 1, 2, hours) || hours > 23)
+            return false;
+
+        seconds = days * SecondsPerDay + hours * 3600;
+        return true;
+    }
+
+    //! Reads :MM:SS following the hour, input must hold 6 characters
+    //! RFC 3339 also allows the leap second 60, which rolls over to the next minute
+    template<typename Char>
+    bool ReadMinutes(const Char* in, boost::int64_t& seconds, const bool rfc3339 = false)
+    {
+        unsigned minutes, second;
+        if (in[0] != Char(':') || !integer::ReadFixed(in + 1, 2, minutes) || in[3] != Char(':') || !integer::ReadFixed(in + 4, 2, second))
+            return false;
+
+        if (minutes > 59 || second > (rfc3339 ? 60u : 59u))
+            return false;
+
+        seconds = minutes * 60 + second;
+        return true;
+    }
+
+    //! Reads YYYY-MM-DDTHH:MM:SS as seconds since epoch, input must hold DateTimeLength characters
+    template<typename Char>
+    bool ReadDateTime(const Char* in, boost::int64_t& seconds, const bool rfc3339 = false)
+    {
+        boost::int64_t minutes;
+        if (!ReadDateHour(in, seconds, rfc3339) || !ReadMinutes(in + DateHourLength, minutes, rfc3339))
+            return false;
+
+        seconds += minutes;
+        return true;
+    }
+
+    //! Reads one or more fraction digits, keeps the first nine as nanoseconds
+    template<typename Char>
+    bool ReadFraction(const Char*& in, const Char* const end, boost::int64_t& nanoseconds)
+    {
+        const Char* const begin = in;
+        boost::int64_t value = 0;
+        int digits = 0;
+        for (; in != end; ++in)
+        {
+            const unsigned digit = static_cast<unsigned>(*in) - '0';
+            if (digit > 9)
+                break;
+            if (digits < 9)
+            {
+                value = value * 10 + digit;
+                ++digits;
+            }
+        }
+        for (; digits < 9; ++digits)
+            value *= 10;
+
+        nanoseconds = value;
+        return in != begin;
+    }
+
+    //! Forms outside RFC 3339 that the date_time facet read and cast<ptime> still takes, besides a date alone:
+    //! a time without seconds, 24:00:00 and a dot without digits or with text after them
+
+    //! Reads :MM ending the input as seconds
+    template<typename Char>
+    bool ReadMinutesOnly(const Char* in, const Char* const end, boost::int64_t& seconds)
+    {
+        unsigned minutes;
+        if (end - in != 3 || in[0] != Char(':') || !integer::ReadFixed(in + 1, 2, minutes) || minutes > 59)
+            return false;
+
+        seconds = minutes * 60;
+        return true;
+    }
+
+    //! Reads YYYY-MM-DDT24:00:00 with an optional Z ending the input as the midnight after the date, in seconds since epoch
+    template<typename Char>
+    bool ReadEndOfDay(const Char* in, const Char* const end, boost::int64_t& seconds)
+    {
+        const std::ptrdiff_t size = end - in;
+        if (size != DateTimeLength && (size != DateTimeLength + 1 || (in[DateTimeLength] != Char('Z') && in[DateTimeLength] != Char('z'))))
+            return false;
+
+        const Char separator = in[DateLength];
+        const Char* const time = in + DateLength + 1;
+        boost::int64_t days;
+        if (!ReadDate(in, days) || (separator != Char('T') && separator != Char('t') && separator != Char(' ')) ||
+            time[0] != Char('2') || time[1] != Char('4') || time[2] != Char(':') || time[3] != Char('0') || time[4] != Char('0') ||
+            time[5] != Char(':') || time[6] != Char('0') || time[7] != Char('0'))
+            return false;
+
+        seconds = (days + 1) * SecondsPerDay;
+        return true;
+    }
+
+    //! Reads the digits after a dot, none are taken as zero and text after them that does not start a zone is skipped
+    template<typename Char>
+    void ReadLenientFraction(const Char*& in, const Char* const end, boost::int64_t& nanoseconds)
+    {
+        ReadFraction(in, end, nanoseconds);
+        if (in != end && *in != Char('Z') && *in != Char('z') && *in != Char('+') && *in != Char('-'))
+            in = end;
+    }
+
+    //! Reads an optional fraction with a leading dot and checks the input is fully consumed, a trailing Z is accepted with zulu
+    template<typename Char>
+    bool ReadTail(const Char* in, const Char* const end, const bool zulu, boost::int64_t& nanoseconds)
+    {
+        nanoseconds = 0;
+        if (in != end && *in == Char('.') && !ReadFraction(++in, end, nanoseconds))
+            return false;
+        if (zulu && in != end && *in == Char('Z'))
+            ++in;
+        return in == end;
+    }
+
+    //! Reads [-]HH:MM:SS with hours not wrapped at a day, stops after the seconds
+    template<typename Char>
+    bool ReadClock(const Char*& in, const Char* const end, bool& negative, boost::int64_t& seconds)
+    {
+        negative = in != end && *in == Char('-');
+        if (negative)
+            ++in;
+
+        // hours are unbounded, twelve digits keep the seconds well inside int64
+        boost::int64_t hours = 0;
+        const Char* const digits = in;
+        for (; in != end && in - digits < 12 && static_cast<unsigned>(*in) - '0' <= 9; ++in)
+            hours = hours * 10 + (*in - '0');
+
+        boost::int64_t minutes;
+        if (in == digits || end - in < 6 || !ReadMinutes(in, minutes))
+            return false;
+
+        in += 6;
+        seconds = hours * 3600 + minutes;
+        return true;
+    }
+
+} // namespace civil
+} // namespace details
+} // namespace conv
+
+#endif // Civil_h__
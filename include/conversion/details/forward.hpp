@@ -0,0 +1,125 @@
+#ifndef ConversionForward_h__
+#define ConversionForward_h__
+
+#include <chrono>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+
+namespace boost
+{
+namespace posix_time
+{
+    class BOOST_SYMBOL_VISIBLE ptime;
+    class BOOST_SYMBOL_VISIBLE time_duration;
+} // namespace posix_time
+
+namespace gregorian
+{
+    class BOOST_SYMBOL_VISIBLE date;
+} // namespace gregorian
+} // namespace boost
+
+namespace conv
+{
+    struct Ansi;
+    struct Base64;
+    struct Hex;
+    struct EpochMicroseconds;
+    struct EpochNanoseconds;
+    struct StrictTime;
+    struct AnyTimestamp;
+
+    template<typename T>
+    class Allocator;
+
+namespace details
+{
+    template<typename T>
+    struct TypeTraits;
+
+    template<typename Target, typename Source>
+    struct Caster;
+
+    //! Casters of the domain headers, declared for every TU so that one used without its header is an incomplete
+    //! type instead of an implicit instantiation of the generic Caster, which would differ from the other TUs
+
+    // text.hpp
+    template<> struct TypeTraits<Ansi>;
+    template<> struct Caster<std::string, std::wstring>;
+    template<> struct Caster<std::wstring, std::string>;
+    template<> struct Caster<std::string, const wchar_t*>;
+    template<> struct Caster<std::wstring, const char*>;
+    template<> struct Caster<std::string, Ansi>;
+    template<> struct Caster<std::wstring, Ansi>;
+    template<> struct Caster<Ansi, std::wstring>;
+    template<> struct Caster<std::string, std::stringstream>;
+
+    // binary.hpp
+    template<> struct TypeTraits<Base64>;
+    template<> struct TypeTraits<Hex>;
+    template<typename Source> struct Caster<Base64, Source>;
+    template<typename Target> struct Caster<Target, Base64>;
+    template<> struct Caster<std::vector<char>, std::string>;
+    template<> struct Caster<std::string, std::vector<char> >;
+    template<> struct Caster<std::vector<unsigned char>, std::string>;
+    template<> struct Caster<std::string, std::vector<unsigned char> >;
+    template<> struct Caster<Hex, std::vector<char> >;
+    template<> struct Caster<std::vector<char>, Hex>;
+    template<> struct Caster<Hex, std::string>;
+    template<> struct Caster<std::string, Hex>;
+
+    // list.hpp
+    template<> struct Caster<std::vector<boost::uint64_t>, std::string>;
+    template<> struct Caster<std::string, std::vector<boost::uint64_t> >;
+    template<> struct Caster<std::vector<std::string>, std::string>;
+    template<> struct Caster<std::string, std::vector<std::string> >;
+
+    // epoch.hpp and time.hpp
+    template<> struct TypeTraits<EpochMicroseconds>;
+    template<> struct TypeTraits<EpochNanoseconds>;
+    template<> struct TypeTraits<StrictTime>;
+    template<> struct Caster<boost::uint64_t, boost::posix_time::ptime>;
+    template<> struct Caster<boost::uint32_t, boost::posix_time::ptime>;
+    template<> struct Caster<EpochMicroseconds, boost::posix_time::ptime>;
+    template<> struct Caster<EpochNanoseconds, boost::posix_time::ptime>;
+    template<> struct Caster<boost::posix_time::ptime, boost::uint64_t>;
+    template<> struct Caster<boost::posix_time::ptime, boost::uint32_t>;
+    template<> struct Caster<boost::posix_time::ptime, EpochMicroseconds>;
+    template<> struct Caster<boost::posix_time::ptime, EpochNanoseconds>;
+    template<> struct Caster<std::string, boost::posix_time::ptime>;
+    template<> struct Caster<boost::posix_time::ptime, std::string>;
+    template<> struct Caster<StrictTime, std::string>;
+    template<> struct Caster<boost::posix_time::ptime, AnyTimestamp>;
+    template<typename Source> struct Caster<AnyTimestamp, Source>;
+    template<> struct Caster<std::string, boost::posix_time::time_duration>;
+    template<> struct Caster<boost::posix_time::time_duration, std::string>;
+    template<> struct Caster<boost::int64_t, boost::posix_time::time_duration>;
+    template<> struct Caster<boost::int32_t, boost::posix_time::time_duration>;
+    template<> struct Caster<boost::posix_time::time_duration, boost::int64_t>;
+    template<> struct Caster<boost::posix_time::time_duration, boost::int32_t>;
+    template<> struct Caster<std::string, boost::gregorian::date>;
+    template<> struct Caster<boost::gregorian::date, std::string>;
+    template<> struct Caster<boost::int32_t, boost::gregorian::date>;
+    template<> struct Caster<boost::gregorian::date, boost::int32_t>;
+
+    // chrono.hpp
+    template<typename Duration> struct Caster<std::string, std::chrono::time_point<std::chrono::system_clock, Duration> >;
+    template<typename Duration> struct Caster<std::chrono::time_point<std::chrono::system_clock, Duration>, std::string>;
+    template<typename Duration> struct Caster<boost::uint64_t, std::chrono::time_point<std::chrono::system_clock, Duration> >;
+    template<typename Duration> struct Caster<boost::uint32_t, std::chrono::time_point<std::chrono::system_clock, Duration> >;
+    template<typename Duration> struct Caster<EpochMicroseconds, std::chrono::time_point<std::chrono::system_clock, Duration> >;
+    template<typename Duration> struct Caster<EpochNanoseconds, std::chrono::time_point<std::chrono::system_clock, Duration> >;
+    template<typename Duration> struct Caster<std::chrono::time_point<std::chrono::system_clock, Duration>, boost::uint64_t>;
+    template<typename Duration> struct Caster<std::chrono::time_point<std::chrono::system_clock, Duration>, boost::uint32_t>;
+    template<typename Duration> struct Caster<std::chrono::time_point<std::chrono::system_clock, Duration>, EpochMicroseconds>;
+    template<typename Duration> struct Caster<std::chrono::time_point<std::chrono::system_clock, Duration>, EpochNanoseconds>;
+    template<typename Rep, typename Period> struct Caster<std::string, std::chrono::duration<Rep, Period> >;
+    template<typename Rep, typename Period> struct Caster<std::chrono::duration<Rep, Period>, std::string>;
+} // namespace details
+} // namespace conv
+
+#endif // ConversionForward_h__
@@ -0,0 +1,347 @@
+#ifndef Grisu_h__
+#define Grisu_h__
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include <boost/cstdint.hpp>
+
+namespace conv
+{
+namespace details
+{
+namespace grisu
+{
+    //! Binary layout of the IEEE 754 floating point types
+    template<typename T>
+    struct FloatTraits;
+
+    template<>
+    struct FloatTraits<float>
+    {
+        typedef boost::uint32_t Bits;
+        static const int SignificandSize = 23;
+        static const int ExponentBias = 0x7F + SignificandSize;
+        static const int Precision = 9; // max_digits10
+    };
+
+    template<>
+    struct FloatTraits<double>
+    {
+        typedef boost::uint64_t Bits;
+        static const int SignificandSize = 52;
+        static const int ExponentBias = 0x3FF + SignificandSize;
+        static const int Precision = 17; // max_digits10
+    };
+
+    //! "Do it yourself" floating point: f * 2^e
+    struct DiyFp
+    {
+        static const int SignificandSize = 64;
+
+        boost::uint64_t f;
+        int e;
+
+        DiyFp(const boost::uint64_t fp, const int exp) : f(fp), e(exp) {}
+
+        DiyFp operator - (const DiyFp& rhs) const
+        {
+            return DiyFp(f - rhs.f, e);
+        }
+
+        DiyFp operator * (const DiyFp& rhs) const
+        {
+            const boost::uint64_t mask = 0xFFFFFFFF;
+            const boost::uint64_t a = f >> 32;
+            const boost::uint64_t b = f & mask;
+            const boost::uint64_t c = rhs.f >> 32;
+            const boost::uint64_t d = rhs.f & mask;
+            const boost::uint64_t ac = a * c;
+            const boost::uint64_t bc = b * c;
+            const boost::uint64_t ad = a * d;
+            const boost::uint64_t bd = b * d;
+            boost::uint64_t tmp = (bd >> 32) + (ad & mask) + (bc & mask);
+            tmp += boost::uint64_t(1) << 31; // round
+            return DiyFp(ac + (ad >> 32) + (bc >> 32) + (tmp >> 32), e + rhs.e + 64);
+        }
+
+        DiyFp Normalize() const
+        {
+            DiyFp result = *this;
+            while (!(result.f & (boost::uint64_t(1) << 63)))
+            {
+                result.f <<= 1;
+                --result.e;
+            }
+            return result;
+        }
+    };
+
+    //! Decomposed value with the boundaries of its rounding interval
+    template<typename T>
+    struct Decomposed
+    {
+        typedef FloatTraits<T> Traits;
+        static const boost::uint64_t HiddenBit = boost::uint64_t(1) << Traits::SignificandSize;
+
+        DiyFp value;
+        DiyFp minus;
+        DiyFp plus;
+
+        explicit Decomposed(const typename Traits::Bits bits) : value(0, 0), minus(0, 0), plus(0, 0)
+        {
+            const boost::uint64_t significand = bits & (HiddenBit - 1);
+            const int exponent = static_cast<int>((bits >> Traits::SignificandSize) & (~typename Traits::Bits(0) >> (Traits::SignificandSize + 1)));
+
+            if (exponent)
+                value = DiyFp(significand + HiddenBit, exponent - Traits::ExponentBias);
+            else
+                value = DiyFp(significand, 1 - Traits::ExponentBias);
+
+            plus = DiyFp((value.f << 1) + 1, value.e - 1);
+            while (!(plus.f & (HiddenBit << 1)))
+            {
+                plus.f <<= 1;
+                --plus.e;
+            }
+            plus.f <<= DiyFp::SignificandSize - Traits::SignificandSize - 2;
+            plus.e -= DiyFp::SignificandSize - Traits::SignificandSize - 2;
+
+            minus = value.f == HiddenBit ? DiyFp((value.f << 2) - 1, value.e - 2) : DiyFp((value.f << 1) - 1, value.e - 1);
+            minus.f <<= minus.e - plus.e;
+            minus.e = plus.e;
+
+            value = value.Normalize();
+        }
+    };
+
+    inline const boost::uint64_t* Pow10()
+    {
+        static const boost::uint64_t values[] =
+        {
+            1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL,
+            1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+            100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL,
+            1000000000000000000ULL, 10000000000000000000ULL
+        };
+        return values;
+    }
+
+    //! Normalized 10^k with k = -348 + 8 * index, such that the product exponent falls in [-60, -32]
+    inline DiyFp CachedPower(const int e, int& k)
+    {
+        static const boost::uint64_t significands[] =
+        {
+                0xfa8fd5a0081c0288, 0xbaaee17fa23ebf76, 0x8b16fb203055ac76,
+                0xcf42894a5dce35ea, 0x9a6bb0aa55653b2d, 0xe61acf033d1a45df,
+                0xab70fe17c79ac6ca, 0xff77b1fcbebcdc4f, 0xbe5691ef416bd60c,
+                0x8dd01fad907ffc3c, 0xd3515c2831559a83, 0x9d71ac8fada6c9b5,
+                0xea9c227723ee8bcb, 0xaecc49914078536d, 0x823c12795db6ce57,
+                0xc21094364dfb5637, 0x9096ea6f3848984f, 0xd77485cb25823ac7,
+                0xa086cfcd97bf97f4, 0xef340a98172aace5, 0xb23867fb2a35b28e,
+                0x84c8d4dfd2c63f3b, 0xc5dd44271ad3cdba, 0x936b9fcebb25c996,
+                0xdbac6c247d62a584, 0xa3ab66580d5fdaf6, 0xf3e2f893dec3f126,
+                0xb5b5ada8aaff80b8, 0x87625f056c7c4a8b, 0xc9bcff6034c13053,
+                0x964e858c91ba2655, 0xdff9772470297ebd, 0xa6dfbd9fb8e5b88f,
+                0xf8a95fcf88747d94, 0xb94470938fa89bcf, 0x8a08f0f8bf0f156b,
+                0xcdb02555653131b6, 0x993fe2c6d07b7fac, 0xe45c10c42a2b3b06,
+                0xaa242499697392d3, 0xfd87b5f28300ca0e, 0xbce5086492111aeb,
+                0x8cbccc096f5088cc, 0xd1b71758e219652c, 0x9c40000000000000,
+                0xe8d4a51000000000, 0xad78ebc5ac620000, 0x813f3978f8940984,
+                0xc097ce7bc90715b3, 0x8f7e32ce7bea5c70, 0xd5d238a4abe98068,
+                0x9f4f2726179a2245, 0xed63a231d4c4fb27, 0xb0de65388cc8ada8,
+                0x83c7088e1aab65db, 0xc45d1df942711d9a, 0x924d692ca61be758,
+                0xda01ee641a708dea, 0xa26da3999aef774a, 0xf209787bb47d6b85,
+                0xb454e4a179dd1877, 0x865b86925b9bc5c2, 0xc83553c5c8965d3d,
+                0x952ab45cfa97a0b3, 0xde469fbd99a05fe3, 0xa59bc234db398c25,
+                0xf6c69a72a3989f5c, 0xb7dcbf5354e9bece, 0x88fcf317f22241e2,
+                0xcc20ce9bd35c78a5, 0x98165af37b2153df, 0xe2a0b5dc971f303a,
+                0xa8d9d1535ce3b396, 0xfb9b7cd9a4a7443c, 0xbb764c4ca7a44410,
+                0x8bab8eefb6409c1a, 0xd01fef10a657842c, 0x9b10a4e5e9913129,
+                0xe7109bfba19c0c9d, 0xac2820d9623bf429, 0x80444b5e7aa7cf85,
+                0xbf21e44003acdd2d, 0x8e679c2f5e44ff8f, 0xd433179d9c8cb841,
+                0x9e19db92b4e31ba9, 0xeb96bf6ebadf77d9, 0xaf87023b9bf0ee6b
+        };
+        static const short exponents[] =
+        {
+                -1220, -1193, -1166, -1140, -1113, -1087, -1060, -1034, -1007, -980,
+                -954, -927, -901, -874, -847, -821, -794, -768, -741, -715,
+                -688, -661, -635, -608, -582, -555, -529, -502, -475, -449,
+                -422, -396, -369, -343, -316, -289, -263, -236, -210, -183,
+                -157, -130, -103, -77, -50, -24, 3, 30, 56, 83,
+                109, 136, 162, 189, 216, 242, 269, 295, 322, 348,
+                375, 402, 428, 455, 481, 508, 534, 561, 588, 614,
+                641, 667, 694, 720, 747, 774, 800, 827, 853, 880,
+                907, 933, 960, 986, 1013, 1039, 1066
+        };
+
+        const double dk = (-61 - e) * 0.30102999566398114 + 347;
+        int index = static_cast<int>(dk);
+        if (dk - index > 0.0)
+            ++index;
+        index = (index >> 3) + 1;
+        k = -(-348 + (index << 3));
+        return DiyFp(significands[index], exponents[index]);
+    }
+
+    inline void Round(char* buffer, const int length, const boost::uint64_t delta, boost::uint64_t rest, const boost::uint64_t tenKappa, const boost::uint64_t distance)
+    {
+        while (rest < distance && delta - rest >= tenKappa && (rest + tenKappa < distance || distance - rest > rest + tenKappa - distance))
+        {
+            --buffer[length - 1];
+            rest += tenKappa;
+        }
+    }
+
+    inline int DigitGen(const DiyFp& w, const DiyFp& upper, boost::uint64_t delta, char* buffer, int& k)
+    {
+        const boost::uint64_t* pow10 = Pow10();
+        const DiyFp one(boost::uint64_t(1) << -upper.e, upper.e);
+        const boost::uint64_t distance = (upper - w).f;
+
+        boost::uint32_t p1 = static_cast<boost::uint32_t>(upper.f >> -one.e);
+        boost::uint64_t p2 = upper.f & (one.f - 1);
+
+        int kappa = 1;
+        while (kappa < 10 && p1 >= pow10[kappa])
+            ++kappa;
+
+        int length = 0;
+        while (kappa > 0)
+        {
+            const boost::uint32_t divisor = static_cast<boost::uint32_t>(pow10[kappa - 1]);
+            const boost::uint32_t digit = p1 / divisor;
+            p1 %= divisor;
+            if (digit || length)
+                buffer[length++] = static_cast<char>('0' + digit);
+            --kappa;
+
+            const boost::uint64_t rest = (static_cast<boost::uint64_t>(p1) << -one.e) + p2;
+            if (rest <= delta)
+            {
+                k += kappa;
+                Round(buffer, length, delta, rest, pow10[kappa] << -one.e, distance);
+                return length;
+            }
+        }
+
+        for (;;)
+        {
+            p2 *= 10;
+            delta *= 10;
+            const char digit = static_cast<char>(p2 >> -one.e);
+            if (digit || length)
+                buffer[length++] = static_cast<char>('0' + digit);
+            p2 &= one.f - 1;
+            --kappa;
+            if (p2 < delta)
+            {
+                k += kappa;
+                Round(buffer, length, delta, p2, one.f, -kappa < 20 ? distance * pow10[-kappa] : 0);
+                return length;
+            }
+        }
+    }
+
+    //! Generates the shortest digit string which rounds back to the value, value = digits * 10^k
+    template<typename T>
+    int Digits(const typename FloatTraits<T>::Bits bits, char* buffer, int& k)
+    {
+        const Decomposed<T> v(bits);
+        const DiyFp power = CachedPower(v.plus.e, k);
+        const DiyFp w = v.value * power;
+        DiyFp upper = v.plus * power;
+        DiyFp lower = v.minus * power;
+        ++lower.f;
+        --upper.f;
+        return DigitGen(w, upper, upper.f - lower.f, buffer, k);
+    }
+
+    inline char* WriteExponent(int exponent, char* out)
+    {
+        *out++ = 'e';
+        *out++ = exponent < 0 ? '-' : '+';
+        if (exponent < 0)
+            exponent = -exponent;
+        if (exponent >= 100)
+        {
+            *out++ = static_cast<char>('0' + exponent / 100);
+            exponent %= 100;
+        }
+        *out++ = static_cast<char>('0' + exponent / 10);
+        *out++ = static_cast<char>('0' + exponent % 10);
+        return out;
+    }
+
+    //! Formats value with the shortest round-trip digits in the "%g" layout, returns the end of the output
+    //! Buffer must hold at least 32 characters
+    template<typename T>
+    char* Format(const T value, char* out)
+    {
+        typedef FloatTraits<T> Traits;
+        typedef typename Traits::Bits Bits;
+
+        Bits bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+
+        const Bits sign = Bits(1) << (sizeof(Bits) * 8 - 1);
+        if (bits & sign)
+        {
+            *out++ = '-';
+            bits &= ~sign;
+        }
+
+        const Bits infinity = ~Bits(0) >> (Traits::SignificandSize + 1) << Traits::SignificandSize;
+        if ((bits & infinity) == infinity)
+        {
+            const char* text = bits == infinity ? "inf" : "nan";
+            return std::copy(text, text + 3, out);
+        }
+
+        if (!bits)
+        {
+            *out++ = '0';
+            return out;
+        }
+
+        char digits[20];
+        int k = 0;
+        const int length = Digits<T>(bits, digits, k);
+        const int exponent = length + k - 1;
+
+        if (exponent < -4 || exponent >= Traits::Precision)
+        {
+            *out++ = digits[0];
+            if (length > 1)
+            {
+                *out++ = '.';
+                out = std::copy(digits + 1, digits + length, out);
+            }
+            return WriteExponent(exponent, out);
+        }
+
+        if (exponent < 0)
+        {
+            *out++ = '0';
+            *out++ = '.';
+            out = std::fill_n(out, -exponent - 1, '0');
+            return std::copy(digits, digits + length, out);
+        }
+
+        if (length <= exponent + 1)
+        {
+            out = std::copy(digits, digits + length, out);
+            return std::fill_n(out, exponent + 1 - length, '0');
+        }
+
+        out = std::copy(digits, digits + exponent + 1, out);
+        *out++ = '.';
+        return std::copy(digits + exponent + 1, digits + length, out);
+    }
+
+} // namespace grisu
+} // namespace details
+} // namespace conv
+
+#endif // Grisu_h__
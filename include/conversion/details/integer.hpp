@@ -0,0 +1,115 @@
+#ifndef Integer_h__
+#define Integer_h__
+
+#include <limits>
+#include <string>
+#include <type_traits>
+
+namespace conv
+{
+namespace details
+{
+namespace integer
+{
+    //! Writes value as exactly width decimal digits, zero padded
+    template<typename T, typename Char>
+    Char* WriteFixed(T value, const int width, Char* out)
+    {
+        for (int i = width - 1; i >= 0; --i)
+        {
+            out[i] = static_cast<Char>('0' + value % 10);
+            value /= 10;
+        }
+        return out + width;
+    }
+
+    //! Reads exactly width decimal digits
+    template<typename T, typename Char>
+    bool ReadFixed(const Char* in, const int width, T& value)
+    {
+        T result = 0;
+        for (int i = 0; i < width; ++i)
+        {
+            const unsigned digit = static_cast<unsigned>(in[i]) - '0';
+            if (digit > 9)
+                return false;
+            result = result * 10 + digit;
+        }
+        value = result;
+        return true;
+    }
+
+    //! Formats value in decimal, writes backwards and returns the first character written
+    //! Buffer must hold digits10 + 2 characters before end
+    template<typename T, typename Char>
+    Char* Format(const T value, Char* end)
+    {
+        typedef typename std::make_unsigned<T>::type Unsigned;
+
+        const bool negative = value < 0;
+        Unsigned rest = negative ? Unsigned(0 - static_cast<Unsigned>(value)) : static_cast<Unsigned>(value);
+
+        Char* out = end;
+        do
+        {
+            *--out = static_cast<Char>('0' + rest % 10);
+            rest /= 10;
+        }
+        while (rest);
+
+        if (negative)
+            *--out = Char('-');
+
+        return out;
+    }
+
+    template<typename String, typename T>
+    String ToString(const T value)
+    {
+        typedef typename String::value_type Char;
+
+        Char buffer[std::numeric_limits<T>::digits10 + 2];
+        Char* const end = buffer + sizeof(buffer) / sizeof(Char);
+        return String(Format(value, end), end);
+    }
+
+    //! Parses optionally signed decimal integer spanning the whole input, with the same rules as boost::lexical_cast
+    //! in the classic locale: no whitespace, leading '+' allowed, negative input for unsigned types wraps around
+    //! Usable in constant expressions, literal_cast parses with it
+    template<typename T, typename Char>
+    constexpr bool Parse(const Char* begin, const Char* const end, T& result)
+    {
+        typedef typename std::make_unsigned<T>::type Unsigned;
+
+        if (begin == end)
+            return false;
+
+        const bool negative = *begin == Char('-');
+        if (negative || *begin == Char('+'))
+        {
+            if (++begin == end)
+                return false;
+        }
+
+        const Unsigned max = std::numeric_limits<Unsigned>::max();
+        Unsigned value = 0;
+        for (; begin != end; ++begin)
+        {
+            const unsigned digit = static_cast<unsigned>(*begin) - '0';
+            if (digit > 9 || value > (max - digit) / 10)
+                return false;
+            value = static_cast<Unsigned>(value * 10 + digit);
+        }
+
+        if (std::is_signed<T>::value && value > static_cast<Unsigned>(std::numeric_limits<T>::max()) + (negative ? 1u : 0u))
+            return false;
+
+        result = static_cast<T>(negative ? Unsigned(0 - value) : value);
+        return true;
+    }
+
+} // namespace integer
+} // namespace details
+} // namespace conv
+
+#endif // Integer_h__
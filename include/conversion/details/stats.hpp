@@ -0,0 +1,224 @@
+#ifndef Stats_h__
+#define Stats_h__
+
+#ifdef CONVERSION_STATS
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <typeinfo>
+#include <type_traits>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+
+#endif // CONVERSION_STATS
+
+namespace conv
+{
+#ifdef CONVERSION_STATS
+template<std::size_t N>
+class FixedString;
+#endif // CONVERSION_STATS
+
+namespace details
+{
+namespace stats
+{
+#ifdef CONVERSION_STATS
+
+    //! Number of distinct Caster specializations that can be tracked, the rest are ignored
+#ifndef CONVERSION_STATS_MAX_CASTERS
+#define CONVERSION_STATS_MAX_CASTERS 256
+#endif
+
+    //! Latency buckets, bucket i holds calls that took [2^i, 2^(i+1)) nanoseconds
+    const std::size_t LatencyBuckets = 32;
+
+    //! Counters of one Caster specialization, written only by the owning thread
+    struct Counters
+    {
+        std::atomic<boost::uint64_t> m_Calls;
+        std::atomic<boost::uint64_t> m_Failures;
+        std::atomic<boost::uint64_t> m_InputBytes;
+        std::atomic<boost::uint64_t> m_OutputBytes;
+        std::atomic<boost::uint64_t> m_Latency[LatencyBuckets];
+    };
+
+    //! Counters of all specializations for one thread
+    struct Block
+    {
+        Counters m_Casters[CONVERSION_STATS_MAX_CASTERS];
+    };
+
+    //! Registers Caster specialization by its type, returns its index
+    std::size_t Register(const std::type_info& caster);
+
+    //! Allocates and publishes counters of the calling thread
+    Block* Attach();
+
+    //! Folds counters of the exiting thread into the totals
+    void Detach(Block* block);
+
+    //! Counters of the calling thread
+    struct ThreadBlock
+    {
+        Block* const m_Block;
+
+        ThreadBlock() : m_Block(Attach()) {}
+        ~ThreadBlock() { Detach(m_Block); }
+    };
+
+    inline Block& Local()
+    {
+        static thread_local ThreadBlock block;
+        return *block.m_Block;
+    }
+
+    //! Single writer increment, no locked instruction needed
+    inline void Add(std::atomic<boost::uint64_t>& counter, const boost::uint64_t value)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+
+    //! Payload size of the value
+    template<typename T, typename Traits, typename Allocator>
+    boost::uint64_t Bytes(const std::basic_string<T, Traits, Allocator>& value)
+    {
+        return value.size() * sizeof(T);
+    }
+
+    template<typename T, typename Allocator>
+    boost::uint64_t Bytes(const std::vector<T, Allocator>& value)
+    {
+        return value.size() * sizeof(T);
+    }
+
+    template<std::size_t N>
+    boost::uint64_t Bytes(const FixedString<N>& value)
+    {
+        return value.size();
+    }
+
+    template<typename Char>
+    boost::uint64_t Bytes(const Char* value)
+    {
+        return value ? std::char_traits<Char>::length(value) * sizeof(Char) : 0;
+    }
+
+    template<typename Char>
+    boost::uint64_t Bytes(Char* value)
+    {
+        return value ? std::char_traits<Char>::length(value) * sizeof(Char) : 0;
+    }
+
+    template<typename T>
+    typename std::enable_if<std::is_arithmetic<T>::value || std::is_enum<T>::value, boost::uint64_t>::type Bytes(const T&)
+    {
+        return sizeof(T);
+    }
+
+    template<typename T>
+    typename std::enable_if<!std::is_arithmetic<T>::value && !std::is_enum<T>::value, boost::uint64_t>::type Bytes(const T&)
+    {
+        return 0;
+    }
+
+    inline std::size_t Bucket(boost::uint64_t nanoseconds)
+    {
+        std::size_t bucket = 0;
+        while (nanoseconds >>= 1)
+            ++bucket;
+        return bucket < LatencyBuckets ? bucket : LatencyBuckets - 1;
+    }
+
+    //! Index of the Caster specialization, shared by Invoke and InvokeInto so it has a single row
+    template<typename Caster>
+    std::size_t Index()
+    {
+        static const std::size_t index = Register(typeid(Caster));
+        return index;
+    }
+
+    //! Calls the caster and records the call in the counters of the calling thread
+    template<typename Caster, typename Source>
+    auto Invoke(const Source& src) -> decltype(Caster()(src))
+    {
+        const std::size_t index = Index<Caster>();
+        if (index >= CONVERSION_STATS_MAX_CASTERS)
+            return Caster()(src);
+
+        Counters& counters = Local().m_Casters[index];
+        Add(counters.m_Calls, 1);
+        Add(counters.m_InputBytes, Bytes(src));
+
+        const auto start = std::chrono::steady_clock::now();
+        try
+        {
+            auto result = Caster()(src);
+
+            const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+            Add(counters.m_Latency[Bucket(elapsed.count())], 1);
+            Add(counters.m_OutputBytes, Bytes(result));
+            return result;
+        }
+        catch (...)
+        {
+            Add(counters.m_Failures, 1);
+            throw;
+        }
+    }
+
+    //! Calls the caster writing into out and records the call like Invoke
+    template<typename Caster, typename Source, typename Result>
+    void InvokeInto(const Source& src, Result& out)
+    {
+        const std::size_t index = Index<Caster>();
+        Caster caster;
+        if (index >= CONVERSION_STATS_MAX_CASTERS)
+            return WriteInto(caster, src, out);
+
+        Counters& counters = Local().m_Casters[index];
+        Add(counters.m_Calls, 1);
+        Add(counters.m_InputBytes, Bytes(src));
+
+        const auto start = std::chrono::steady_clock::now();
+        try
+        {
+            WriteInto(caster, src, out);
+
+            const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+            Add(counters.m_Latency[Bucket(elapsed.count())], 1);
+            Add(counters.m_OutputBytes, Bytes(out));
+        }
+        catch (...)
+        {
+            Add(counters.m_Failures, 1);
+            throw;
+        }
+    }
+
+#else
+
+    //! Calls the caster, instrumentation is compiled out
+    template<typename Caster, typename Source>
+    inline auto Invoke(const Source& src) -> decltype(Caster()(src))
+    {
+        return Caster()(src);
+    }
+
+    //! Calls the caster writing into out, instrumentation is compiled out
+    template<typename Caster, typename Source, typename Result>
+    inline void InvokeInto(const Source& src, Result& out)
+    {
+        Caster caster;
+        WriteInto(caster, src, out);
+    }
+
+#endif // CONVERSION_STATS
+} // namespace stats
+} // namespace details
+} // namespace conv
+
+#endif // Stats_h__
@@ -0,0 +1,274 @@
+#ifndef Utf_h__
+#define Utf_h__
+
+#include <cstddef>
+
+#include <boost/cstdint.hpp>
+
+namespace conv
+{
+namespace details
+{
+namespace utf
+{
+    typedef boost::uint32_t CodePoint;
+
+    //! Returned by the decoders for malformed input, the offending units are skipped
+    const CodePoint Illegal = 0xFFFFFFFFu;
+
+    inline bool IsValid(const CodePoint cp)
+    {
+        return cp <= 0x10FFFF && (cp < 0xD800 || cp > 0xDFFF);
+    }
+
+    //! Decodes one code point from UTF-8, consumes at least one unit
+    template<typename Iterator>
+    CodePoint DecodeUtf8(Iterator& it, const Iterator end)
+    {
+        const unsigned char lead = static_cast<unsigned char>(*it++);
+        if (lead < 0x80)
+            return lead;
+
+        int trail;
+        CodePoint cp;
+        if (lead < 0xC2)
+            return Illegal;
+        else if (lead < 0xE0)
+            trail = 1, cp = lead & 0x1F;
+        else if (lead < 0xF0)
+            trail = 2, cp = lead & 0x0F;
+        else if (lead <= 0xF4)
+            trail = 3, cp = lead & 0x07;
+        else
+            return Illegal;
+
+        for (int i = 0; i < trail; ++i)
+        {
+            if (it == end)
+                return Illegal;
+
+            const unsigned char next = static_cast<unsigned char>(*it++);
+            if ((next & 0xC0) != 0x80)
+                return Illegal;
+
+            cp = (cp << 6) | (next & 0x3F);
+        }
+
+        // overlong forms and out of range values
+        static const CodePoint minimal[] = {0, 0x80, 0x800, 0x10000};
+        if (!IsValid(cp) || cp < minimal[trail])
+            return Illegal;
+
+        return cp;
+    }
+
+    //! Encodes valid code point to UTF-8
+    template<typename String>
+    void EncodeUtf8(const CodePoint cp, String& out)
+    {
+        typedef typename String::value_type Char;
+
+        if (cp < 0x80)
+        {
+            out.push_back(static_cast<Char>(cp));
+        }
+        else if (cp < 0x800)
+        {
+            out.push_back(static_cast<Char>(0xC0 | (cp >> 6)));
+            out.push_back(static_cast<Char>(0x80 | (cp & 0x3F)));
+        }
+        else if (cp < 0x10000)
+        {
+            out.push_back(static_cast<Char>(0xE0 | (cp >> 12)));
+            out.push_back(static_cast<Char>(0x80 | ((cp >> 6) & 0x3F)));
+            out.push_back(static_cast<Char>(0x80 | (cp & 0x3F)));
+        }
+        else
+        {
+            out.push_back(static_cast<Char>(0xF0 | (cp >> 18)));
+            out.push_back(static_cast<Char>(0x80 | ((cp >> 12) & 0x3F)));
+            out.push_back(static_cast<Char>(0x80 | ((cp >> 6) & 0x3F)));
+            out.push_back(static_cast<Char>(0x80 | (cp & 0x3F)));
+        }
+    }
+
+    //! Wide character encoding, UTF-16 for 2 byte wchar_t and UTF-32 otherwise
+    template<std::size_t Size = sizeof(wchar_t)>
+    struct Wide
+    {
+        template<typename Iterator>
+        static CodePoint Decode(Iterator& it, const Iterator)
+        {
+            const CodePoint cp = static_cast<CodePoint>(*it++);
+            return IsValid(cp) ? cp : Illegal;
+        }
+
+        template<typename String>
+        static void Encode(const CodePoint cp, String& out)
+        {
+            out.push_back(static_cast<typename String::value_type>(cp));
+        }
+    };
+
+    template<>
+    struct Wide<2>
+    {
+        template<typename Iterator>
+        static CodePoint Decode(Iterator& it, const Iterator end)
+        {
+            const CodePoint first = static_cast<boost::uint16_t>(*it++);
+            if (first < 0xD800 || first > 0xDFFF)
+                return first;
+            if (first > 0xDBFF || it == end)
+                return Illegal;
+
+            const CodePoint second = static_cast<boost::uint16_t>(*it++);
+            if (second < 0xDC00 || second > 0xDFFF)
+                return Illegal;
+
+            return 0x10000 + ((first - 0xD800) << 10) + (second - 0xDC00);
+        }
+
+        template<typename String>
+        static void Encode(const CodePoint cp, String& out)
+        {
+            typedef typename String::value_type Char;
+
+            if (cp < 0x10000)
+            {
+                out.push_back(static_cast<Char>(cp));
+            }
+            else
+            {
+                out.push_back(static_cast<Char>(0xD800 + ((cp - 0x10000) >> 10)));
+                out.push_back(static_cast<Char>(0xDC00 + ((cp - 0x10000) & 0x3FF)));
+            }
+        }
+    };
+
+    //! Windows-1251 code page, upper half to Unicode, 0 marks the undefined 0x98
+    inline const boost::uint16_t* Cp1251Table()
+    {
+        static const boost::uint16_t table[] =
+        {
+            0x0402, 0x0403, 0x201A, 0x0453, 0x201E, 0x2026, 0x2020, 0x2021,
+            0x20AC, 0x2030, 0x0409, 0x2039, 0x040A, 0x040C, 0x040B, 0x040F,
+            0x0452, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+            0x0000, 0x2122, 0x0459, 0x203A, 0x045A, 0x045C, 0x045B, 0x045F,
+            0x00A0, 0x040E, 0x045E, 0x0408, 0x00A4, 0x0490, 0x00A6, 0x00A7,
+            0x0401, 0x00A9, 0x0404, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x0407,
+            0x00B0, 0x00B1, 0x0406, 0x0456, 0x0491, 0x00B5, 0x00B6, 0x00B7,
+            0x0451, 0x2116, 0x0454, 0x00BB, 0x0458, 0x0405, 0x0455, 0x0457,
+            0x0410, 0x0411, 0x0412, 0x0413, 0x0414, 0x0415, 0x0416, 0x0417,
+            0x0418, 0x0419, 0x041A, 0x041B, 0x041C, 0x041D, 0x041E, 0x041F,
+            0x0420, 0x0421, 0x0422, 0x0423, 0x0424, 0x0425, 0x0426, 0x0427,
+            0x0428, 0x0429, 0x042A, 0x042B, 0x042C, 0x042D, 0x042E, 0x042F,
+            0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437,
+            0x0438, 0x0439, 0x043A, 0x043B, 0x043C, 0x043D, 0x043E, 0x043F,
+            0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447,
+            0x0448, 0x0449, 0x044A, 0x044B, 0x044C, 0x044D, 0x044E, 0x044F
+        };
+        return table;
+    }
+
+    template<typename Iterator>
+    CodePoint DecodeCp1251(Iterator& it, const Iterator)
+    {
+        const unsigned char byte = static_cast<unsigned char>(*it++);
+        if (byte < 0x80)
+            return byte;
+
+        const CodePoint cp = Cp1251Table()[byte - 0x80];
+        return cp ? cp : Illegal;
+    }
+
+    //! Encodes code point to Windows-1251, characters missing from the code page are skipped
+    template<typename String>
+    void EncodeCp1251(const CodePoint cp, String& out)
+    {
+        typedef typename String::value_type Char;
+
+        if (cp < 0x80)
+        {
+            out.push_back(static_cast<Char>(cp));
+            return;
+        }
+
+        // Cyrillic capital A to small ya are laid out contiguously from 0xC0
+        if (cp >= 0x0410 && cp <= 0x044F)
+        {
+            out.push_back(static_cast<Char>(0xC0 + (cp - 0x0410)));
+            return;
+        }
+
+        const boost::uint16_t* const table = Cp1251Table();
+        for (unsigned i = 0; i < 0x40; ++i)
+        {
+            if (table[i] == cp)
+            {
+                out.push_back(static_cast<Char>(0x80 + i));
+                return;
+            }
+        }
+    }
+
+    template<typename Iterator, typename String>
+    void Utf8ToWide(Iterator it, const Iterator end, String& out)
+    {
+        while (it != end)
+        {
+            const CodePoint cp = DecodeUtf8(it, end);
+            if (cp != Illegal)
+                Wide<>::Encode(cp, out);
+        }
+    }
+
+    template<typename Iterator, typename String>
+    void WideToUtf8(Iterator it, const Iterator end, String& out)
+    {
+        while (it != end)
+        {
+            const CodePoint cp = Wide<>::Decode(it, end);
+            if (cp != Illegal)
+                EncodeUtf8(cp, out);
+        }
+    }
+
+    template<typename Iterator, typename String>
+    void Cp1251ToUtf8(Iterator it, const Iterator end, String& out)
+    {
+        while (it != end)
+        {
+            const CodePoint cp = DecodeCp1251(it, end);
+            if (cp != Illegal)
+                EncodeUtf8(cp, out);
+        }
+    }
+
+    template<typename Iterator, typename String>
+    void Cp1251ToWide(Iterator it, const Iterator end, String& out)
+    {
+        while (it != end)
+        {
+            const CodePoint cp = DecodeCp1251(it, end);
+            if (cp != Illegal)
+                Wide<>::Encode(cp, out);
+        }
+    }
+
+    template<typename Iterator, typename String>
+    void WideToCp1251(Iterator it, const Iterator end, String& out)
+    {
+        while (it != end)
+        {
+            const CodePoint cp = Wide<>::Decode(it, end);
+            if (cp != Illegal)
+                EncodeCp1251(cp, out);
+        }
+    }
+
+} // namespace utf
+} // namespace details
+} // namespace conv
+
+#endif // Utf_h__
@@ -0,0 +1,30 @@
+#ifndef ConversionEpoch_h__
+#define ConversionEpoch_h__
+
+#include "conversion/numeric.hpp"
+
+#include <boost/cstdint.hpp>
+
+namespace conv
+{
+    //! Tags of counts since 1970-01-01 00:00:00 UTC finer than the milliseconds of plain uint64
+    struct EpochMicroseconds {};
+    struct EpochNanoseconds {};
+
+	namespace details
+	{
+        template<>
+        struct TypeTraits<EpochMicroseconds>
+        {
+            typedef boost::uint64_t Type;
+        };
+
+        template<>
+        struct TypeTraits<EpochNanoseconds>
+        {
+            typedef boost::uint64_t Type;
+        };
+	} // namespace details
+} // namespace conv
+
+#endif // ConversionEpoch_h__
@@ -0,0 +1,250 @@
+#ifndef ConversionFixed_h__
+#define ConversionFixed_h__
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#if __cplusplus >= 201703L
+#include <string_view>
+#endif
+
+#include "conversion/details/caster.hpp"
+
+#include <boost/cstdint.hpp>
+#include <boost/utility/string_view.hpp>
+
+namespace conv
+{
+    //! String of at most N characters kept inside the object, the result of casts to Inline<T>
+    template<std::size_t N>
+    class FixedString
+    {
+    public:
+        typedef char value_type;
+        typedef std::size_t size_type;
+        typedef const char* const_iterator;
+        typedef const char* iterator;
+
+        FixedString() : m_Size(0)
+        {
+            m_Data[0] = '\0';
+        }
+
+        const char* data() const { return m_Data; }
+        const char* c_str() const { return m_Data; }
+        std::size_t size() const { return m_Size; }
+        std::size_t length() const { return m_Size; }
+        bool empty() const { return !m_Size; }
+        static constexpr std::size_t capacity() { return N; }
+        static constexpr std::size_t max_size() { return N; }
+
+        const char* begin() const { return m_Data; }
+        const char* end() const { return m_Data + m_Size; }
+        char operator [] (const std::size_t index) const { return m_Data[index]; }
+
+        void clear()
+        {
+            m_Size = 0;
+            m_Data[0] = '\0';
+        }
+
+        //! Throws std::length_error past N characters, as a full std::string would
+        template<typename Iterator>
+        void assign(Iterator first, Iterator last)
+        {
+            const std::size_t size = static_cast<std::size_t>(std::distance(first, last));
+            if (size > N)
+                throw std::length_error("conv::FixedString");
+            std::copy(first, last, m_Data);
+            m_Size = size;
+            m_Data[size] = '\0';
+        }
+
+        void assign(const char* text)
+        {
+            assign(text, text + std::strlen(text));
+        }
+
+        void push_back(const char c)
+        {
+            if (m_Size == N)
+                throw std::length_error("conv::FixedString");
+            m_Data[m_Size++] = c;
+            m_Data[m_Size] = '\0';
+        }
+
+        std::string str() const
+        {
+            return std::string(m_Data, m_Size);
+        }
+
+        operator std::string () const
+        {
+            return str();
+        }
+
+        operator boost::string_view () const
+        {
+            return boost::string_view(m_Data, m_Size);
+        }
+
+#if __cplusplus >= 201703L
+        operator std::string_view () const
+        {
+            return std::string_view(m_Data, m_Size);
+        }
+#endif
+
+        friend bool operator == (const FixedString& left, const FixedString& right)
+        {
+            return boost::string_view(left) == boost::string_view(right);
+        }
+
+        friend bool operator == (const FixedString& left, const boost::string_view right)
+        {
+            return boost::string_view(left) == right;
+        }
+
+        friend bool operator == (const boost::string_view left, const FixedString& right)
+        {
+            return left == boost::string_view(right);
+        }
+
+        friend bool operator != (const FixedString& left, const FixedString& right)
+        {
+            return !(left == right);
+        }
+
+        friend bool operator != (const FixedString& left, const boost::string_view right)
+        {
+            return !(left == right);
+        }
+
+        friend bool operator != (const boost::string_view left, const FixedString& right)
+        {
+            return !(left == right);
+        }
+
+        friend std::ostream& operator << (std::ostream& out, const FixedString& value)
+        {
+            return out.write(value.m_Data, static_cast<std::streamsize>(value.m_Size));
+        }
+
+    private:
+        char m_Data[N + 1];
+        std::size_t m_Size;
+    };
+
+    //! Target tag, cast<Inline<T> >(value) formats a T as cast<std::string> does into a FixedString on the stack
+    //! Defined for integers, bool, enums, floating point, ptime, time_duration and date
+    template<typename T>
+    struct Inline {};
+
+	namespace details
+	{
+        //! Longest text of a value of T, specialized for the types Inline supports
+        template<typename T, typename Enable = void>
+        struct InlineLength;
+
+        //! Digits of value, at least one
+        constexpr std::size_t DecimalDigits(const boost::uint64_t value)
+        {
+            return value < 10 ? 1 : 1 + DecimalDigits(value / 10);
+        }
+
+        template<typename T>
+        struct InlineLength<T, typename boost::enable_if<IsInteger<T> >::type>
+        {
+            static const std::size_t Value = std::numeric_limits<T>::digits10 + 1 + std::numeric_limits<T>::is_signed;
+        };
+
+        template<>
+        struct InlineLength<unsigned char>
+        {
+            static const std::size_t Value = 3;
+        };
+
+        template<>
+        struct InlineLength<bool>
+        {
+            static const std::size_t Value = 5;
+        };
+
+        //! Enums are written as their promoted underlying value
+        template<typename T>
+        struct InlineLength<T, typename boost::enable_if<boost::is_enum<T> >::type> : InlineLength<typename NumericValue<T>::Promoted>
+        {
+        };
+
+        //! -d.dddddddde-dd
+        template<>
+        struct InlineLength<float>
+        {
+            static const std::size_t Value = 16;
+        };
+
+        //! -d.dddddddddddddddde-ddd
+        template<>
+        struct InlineLength<double>
+        {
+            static const std::size_t Value = 24;
+        };
+
+        template<typename T>
+        struct TypeTraits<Inline<T> >
+        {
+            typedef FixedString<InlineLength<T>::Value> Type;
+        };
+
+        //! Formats with the string caster of T, through its Into member when it has one
+        template<typename T, typename Source>
+        struct InlineCaster
+        {
+            typedef typename TypeTraits<Inline<T> >::Type Result;
+
+            Result operator () (const Source& src)
+            {
+                return Format(src, boost::is_same<T, Source>());
+            }
+
+        private:
+            static Result Format(const Source& src, boost::true_type)
+            {
+                Result result;
+                Caster<std::string, T> caster;
+                WriteInto(caster, src, result);
+                return result;
+            }
+
+            //! Other sources are cast to T first
+            static Result Format(const Source& src, boost::false_type)
+            {
+                return InlineCaster<T, T>()(Caster<T, Source>()(src));
+            }
+        };
+
+        template<typename T, typename Source>
+        struct Caster<Inline<T>, Source> : InlineCaster<T, Source>
+        {
+        };
+
+        template<typename T>
+        struct Caster<Inline<T>, bool> : InlineCaster<T, bool>
+        {
+        };
+
+        template<typename T>
+        struct Caster<Inline<T>, unsigned char> : InlineCaster<T, unsigned char>
+        {
+        };
+	} // namespace details
+} // namespace conv
+
+#endif // ConversionFixed_h__
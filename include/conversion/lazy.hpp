@@ -0,0 +1,158 @@
+#ifndef ConversionLazy_h__
+#define ConversionLazy_h__
+
+#include <atomic>
+#include <thread>
+
+#include "conversion/details/caster.hpp"
+
+namespace conv
+{
+    //! Result of lazy_cast, refers to the source and casts it on the first read, the result is kept for the later ones
+    //! A cast that throws is not remembered, the next read tries again. Results must be default constructible
+    //! Not synchronized, see SharedLazy
+    template<typename Target, typename From, typename Source>
+    class Lazy
+    {
+    public:
+        typedef typename details::TypeTraits<Target>::Type Result;
+
+        explicit Lazy(const Source& src) : m_Source(&src), m_Result(), m_Evaluated(false)
+        {
+        }
+
+        const Result& Get() const
+        {
+            if (!m_Evaluated)
+            {
+                m_Result = details::stats::Invoke<details::Caster<Target, From> >(*m_Source);
+                m_Evaluated = true;
+            }
+            return m_Result;
+        }
+
+        bool IsEvaluated() const
+        {
+            return m_Evaluated;
+        }
+
+        operator const Result& () const { return Get(); }
+        const Result& operator * () const { return Get(); }
+        const Result* operator -> () const { return &Get(); }
+
+    private:
+        const Source* m_Source;
+        mutable Result m_Result;
+        mutable bool m_Evaluated;
+    };
+
+    //! Lazy that may be read from several threads at once, the first reader casts and the others wait for it
+    template<typename Target, typename From, typename Source>
+    class SharedLazy
+    {
+    public:
+        typedef typename details::TypeTraits<Target>::Type Result;
+
+        explicit SharedLazy(const Source& src) : m_Source(&src), m_State(Empty), m_Result()
+        {
+        }
+
+        //! Takes the result over when it is ready, the copy must not race with the first read
+        SharedLazy(const SharedLazy& other) : m_Source(other.m_Source), m_State(Empty), m_Result()
+        {
+            if (other.m_State.load(std::memory_order_acquire) == Ready)
+            {
+                m_Result = other.m_Result;
+                m_State.store(Ready, std::memory_order_relaxed);
+            }
+        }
+
+        SharedLazy& operator = (const SharedLazy&) = delete;
+
+        const Result& Get() const
+        {
+            if (m_State.load(std::memory_order_acquire) == Ready)
+                return m_Result;
+
+            for (int expected = Empty;; expected = Empty)
+            {
+                if (m_State.compare_exchange_weak(expected, Busy, std::memory_order_acquire, std::memory_order_acquire))
+                {
+                    try
+                    {
+                        m_Result = details::stats::Invoke<details::Caster<Target, From> >(*m_Source);
+                    }
+                    catch (...)
+                    {
+                        m_State.store(Empty, std::memory_order_release);
+                        throw;
+                    }
+                    m_State.store(Ready, std::memory_order_release);
+                    return m_Result;
+                }
+                if (expected == Ready)
+                    return m_Result;
+                std::this_thread::yield();
+            }
+        }
+
+        bool IsEvaluated() const
+        {
+            return m_State.load(std::memory_order_acquire) == Ready;
+        }
+
+        operator const Result& () const { return Get(); }
+        const Result& operator * () const { return Get(); }
+        const Result* operator -> () const { return &Get(); }
+
+    private:
+        enum State { Empty, Busy, Ready };
+
+        const Source* m_Source;
+        mutable std::atomic<int> m_State;
+        mutable Result m_Result;
+    };
+
+    //! Lazy cast function, src must outlive the result
+    template<typename Target, typename Source>
+    inline Lazy<Target, Source, Source> lazy_cast(const Source& value)
+    {
+        return Lazy<Target, Source, Source>(value);
+    }
+
+    //! Lazy cast function
+    template<typename Target, typename From, typename Source>
+    inline Lazy<Target, From, Source> lazy_cast(const Source& value)
+    {
+        return Lazy<Target, From, Source>(value);
+    }
+
+    //! Temporaries would be gone before the read
+    template<typename Target, typename Source>
+    void lazy_cast(const Source&& value) = delete;
+
+    template<typename Target, typename From, typename Source>
+    void lazy_cast(const Source&& value) = delete;
+
+    //! Lazy cast function, the result may be read from several threads
+    template<typename Target, typename Source>
+    inline SharedLazy<Target, Source, Source> shared_lazy_cast(const Source& value)
+    {
+        return SharedLazy<Target, Source, Source>(value);
+    }
+
+    //! Lazy cast function, the result may be read from several threads
+    template<typename Target, typename From, typename Source>
+    inline SharedLazy<Target, From, Source> shared_lazy_cast(const Source& value)
+    {
+        return SharedLazy<Target, From, Source>(value);
+    }
+
+    template<typename Target, typename Source>
+    void shared_lazy_cast(const Source&& value) = delete;
+
+    template<typename Target, typename From, typename Source>
+    void shared_lazy_cast(const Source&& value) = delete;
+} // namespace conv
+
+#endif // ConversionLazy_h__
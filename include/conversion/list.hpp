@@ -0,0 +1,61 @@
+#ifndef ConversionList_h__
+#define ConversionList_h__
+
+#include <string>
+#include <vector>
+
+#include "conversion/numeric.hpp"
+
+#include <boost/cstdint.hpp>
+
+namespace conv
+{
+	namespace details
+	{
+        //! Specialized help struct - conversion string to vector of integers
+        template<>
+        struct Caster<std::vector<boost::uint64_t>, std::string>
+        {
+            std::vector<boost::uint64_t> operator () (const std::string& src);
+
+            //! Replaces the contents of a container of std::allocator or conv::Allocator
+            template<typename Result>
+            typename boost::enable_if<IsCompiledInto<Result, std::vector<boost::uint64_t> > >::type Into(const std::string& src, Result& out);
+        };
+
+        //! Specialized help struct - conversion vector of integers to string
+        template<>
+        struct Caster<std::string, std::vector<boost::uint64_t>>
+        {
+            std::string operator () (const std::vector<boost::uint64_t>& src);
+
+            //! Replaces the contents of a string of std::allocator or conv::Allocator
+            template<typename Result>
+            typename boost::enable_if<IsCompiledInto<Result, std::string> >::type Into(const std::vector<boost::uint64_t>& src, Result& out);
+        };
+
+        //! Specialized help struct - conversion string to vector of strings
+        template<>
+        struct Caster<std::vector<std::string>, std::string>
+        {
+            std::vector<std::string> operator () (const std::string& src);
+
+            //! Replaces the contents of a container of std::allocator or conv::Allocator
+            template<typename Result>
+            typename boost::enable_if<IsCompiledInto<Result, std::vector<std::string> > >::type Into(const std::string& src, Result& out);
+        };
+
+        //! Specialized help struct - conversion vector of strings to string
+        template<>
+        struct Caster<std::string, std::vector<std::string>>
+        {
+            std::string operator () (const std::vector<std::string>& src);
+
+            //! Replaces the contents of a string of std::allocator or conv::Allocator
+            template<typename Result>
+            typename boost::enable_if<IsCompiledInto<Result, std::string> >::type Into(const std::vector<std::string>& src, Result& out);
+        };
+	} // namespace details
+} // namespace conv
+
+#endif // ConversionList_h__
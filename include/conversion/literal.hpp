@@ -0,0 +1,242 @@
+#ifndef ConversionLiteral_h__
+#define ConversionLiteral_h__
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "conversion/details/caster.hpp"
+#include "conversion/details/integer.hpp"
+#include "conversion/binary.hpp"
+
+namespace conv
+{
+    //! Entry of the names of an enum for literal_cast, see HasEnumNames
+    template<typename T>
+    struct EnumName
+    {
+        const char* Name;
+        T Value;
+    };
+
+	namespace details
+	{
+        //! Enums with conv_enum_names(T) found by ADL, it returns a std::array or a reference to an array of EnumName<T>
+        //! and has to be constexpr for names to be read at compile time
+        template<typename T, typename = void>
+        struct HasEnumNames : boost::false_type
+        {
+        };
+
+        template<typename T>
+        struct HasEnumNames<T, typename VoidType<decltype(conv_enum_names(std::declval<T>()))>::Type> : boost::true_type
+        {
+        };
+
+    namespace literal
+    {
+        //! Not constexpr, reaching it in a constant expression is what fails the compilation of a malformed literal
+        inline void Malformed()
+        {
+            ThrowCast<const char*>();
+        }
+
+        constexpr bool Equal(const char* left, const char* right, const std::size_t size)
+        {
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                if (!right[i] || left[i] != right[i])
+                    return false;
+            }
+            return !right[size];
+        }
+
+        //! Value of a hex digit of either case, 16 for others
+        constexpr unsigned Nibble(const char c)
+        {
+            return c >= '0' && c <= '9' ? unsigned(c - '0') : c >= 'a' && c <= 'f' ? unsigned(c - 'a' + 10) : c >= 'A' && c <= 'F' ? unsigned(c - 'A' + 10) : 16;
+        }
+
+        //! Value of a base64 digit, 64 for others
+        constexpr unsigned Sextet(const char c)
+        {
+            return c >= 'A' && c <= 'Z' ? unsigned(c - 'A') : c >= 'a' && c <= 'z' ? unsigned(c - 'a' + 26) : c >= '0' && c <= '9' ? unsigned(c - '0' + 52) : c == '+' ? 62 : c == '/' ? 63 : 64;
+        }
+
+        constexpr unsigned HexByte(const char* text, const std::size_t index)
+        {
+            return Nibble(text[index * 2]) << 4 | Nibble(text[index * 2 + 1]);
+        }
+
+        //! Byte of a padded base64 text, '=' counts as zero bits
+        constexpr unsigned Base64Byte(const char* text, const std::size_t index)
+        {
+            const char* const group = text + index / 3 * 4;
+            const unsigned bits = (Sextet(group[0]) & 63) << 18 | (Sextet(group[1]) & 63) << 12 | (Sextet(group[2]) & 63) << 6 | (Sextet(group[3]) & 63);
+            return bits >> (16 - index % 3 * 8) & 0xFF;
+        }
+
+        constexpr bool IsHex(const char* text, const std::size_t size)
+        {
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                if (Nibble(text[i]) > 15)
+                    return false;
+            }
+            return true;
+        }
+
+        //! Whole groups of four with at most two '=' at the very end, bytes is the decoded size
+        constexpr bool IsBase64(const char* text, const std::size_t size, const std::size_t bytes)
+        {
+            std::size_t padding = 0;
+            while (padding < 2 && padding < size && text[size - 1 - padding] == '=')
+                ++padding;
+            for (std::size_t i = 0; i < size - padding; ++i)
+            {
+                if (Sextet(text[i]) > 63)
+                    return false;
+            }
+            return size / 4 * 3 - padding == bytes;
+        }
+
+        template<typename Byte, std::size_t... Index>
+        constexpr std::array<Byte, sizeof...(Index)> Hex(const char* text, std::index_sequence<Index...>)
+        {
+            return {{ static_cast<Byte>(HexByte(text, Index))... }};
+        }
+
+        template<typename Byte, std::size_t... Index>
+        constexpr std::array<Byte, sizeof...(Index)> Base64(const char* text, std::index_sequence<Index...>)
+        {
+            return {{ static_cast<Byte>(Base64Byte(text, Index))... }};
+        }
+
+        template<typename T, std::size_t N>
+        constexpr std::size_t Count(const std::array<T, N>&)
+        {
+            return N;
+        }
+
+        template<typename T, std::size_t N>
+        constexpr std::size_t Count(const T (&)[N])
+        {
+            return N;
+        }
+
+        //! Parses the N characters of text, the From tag picks the encoding of arrays
+        template<typename Target, typename From, typename Enable = void>
+        struct Parser;
+
+        //! Decimal integers with the rules of cast<T>(std::string)
+        template<typename T>
+        struct Parser<T, T, typename boost::enable_if<IsInteger<T> >::type>
+        {
+            template<std::size_t N>
+            static constexpr T Parse(const char* text)
+            {
+                T result = 0;
+                if (!integer::Parse(text, text + N, result))
+                    Malformed();
+                return result;
+            }
+        };
+
+        //! true, false, 1 and 0
+        template<>
+        struct Parser<bool, bool>
+        {
+            template<std::size_t N>
+            static constexpr bool Parse(const char* text)
+            {
+                if (Equal(text, "true", N) || Equal(text, "1", N))
+                    return true;
+                if (!Equal(text, "false", N) && !Equal(text, "0", N))
+                    Malformed();
+                return false;
+            }
+        };
+
+        //! Names from conv_enum_names, the underlying value for enums without them
+        template<typename T>
+        struct Parser<T, T, typename boost::enable_if<boost::is_enum<T> >::type>
+        {
+            template<std::size_t N>
+            static constexpr T Parse(const char* text)
+            {
+                return Parse<N>(text, HasEnumNames<T>());
+            }
+
+        private:
+            template<std::size_t N>
+            static constexpr T Parse(const char* text, boost::true_type)
+            {
+                const auto& names = conv_enum_names(T());
+                for (std::size_t i = 0; i < Count(names); ++i)
+                {
+                    if (Equal(text, names[i].Name, N))
+                        return names[i].Value;
+                }
+                Malformed();
+                return T();
+            }
+
+            template<std::size_t N>
+            static constexpr T Parse(const char* text, boost::false_type)
+            {
+                typename std::underlying_type<T>::type result = 0;
+                if (!integer::Parse(text, text + N, result))
+                    Malformed();
+                return static_cast<T>(result);
+            }
+        };
+
+        //! Two digits a byte, the size of the array has to match the literal
+        template<typename Byte, std::size_t Size>
+        struct Parser<std::array<Byte, Size>, conv::Hex, typename boost::enable_if<boost::mpl::or_<boost::is_same<Byte, char>, boost::is_same<Byte, unsigned char> > >::type>
+        {
+            template<std::size_t N>
+            static constexpr std::array<Byte, Size> Parse(const char* text)
+            {
+                static_assert(N == Size * 2, "hex literal must have two digits per byte of the array");
+                if (!IsHex(text, N))
+                    Malformed();
+                return Hex<Byte>(text, std::make_index_sequence<Size>());
+            }
+        };
+
+        //! Padded base64, the size of the array has to match the decoded literal
+        template<typename Byte, std::size_t Size>
+        struct Parser<std::array<Byte, Size>, conv::Base64, typename boost::enable_if<boost::mpl::or_<boost::is_same<Byte, char>, boost::is_same<Byte, unsigned char> > >::type>
+        {
+            template<std::size_t N>
+            static constexpr std::array<Byte, Size> Parse(const char* text)
+            {
+                static_assert(N % 4 == 0 && Size <= N / 4 * 3 && Size + 2 >= N / 4 * 3, "base64 literal must be padded and decode to the size of the array");
+                if (!IsBase64(text, N, Size))
+                    Malformed();
+                return Base64<Byte>(text, std::make_index_sequence<Size>());
+            }
+        };
+
+        //! Byte arrays are base64 by default, as std::vector<char> from std::string is
+        template<typename Byte, std::size_t Size>
+        struct Parser<std::array<Byte, Size>, std::array<Byte, Size> > : Parser<std::array<Byte, Size>, conv::Base64>
+        {
+        };
+    } // namespace literal
+	} // namespace details
+
+    //! Cast function for string literals that can run at compile time, constexpr int port = literal_cast<int>("8080");
+    //! Integers, bool and enums, from names with conv_enum_names, or std::array<char> and std::array<unsigned char>
+    //! from Hex or Base64 text. Malformed literals fail to compile in constant expressions and throw CastException
+    //! otherwise, an array that does not fit the length of the text is a compile error either way
+    template<typename Target, typename From = Target, std::size_t N>
+    constexpr Target literal_cast(const char (&text)[N])
+    {
+        return details::literal::Parser<Target, From>::template Parse<N - 1>(text);
+    }
+} // namespace conv
+
+#endif // ConversionLiteral_h__
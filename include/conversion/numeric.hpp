@@ -0,0 +1,276 @@
+#ifndef ConversionNumeric_h__
+#define ConversionNumeric_h__
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "conversion/details/caster.hpp"
+#include "conversion/details/grisu.hpp"
+
+namespace conv
+{
+	namespace details
+	{
+        //! Boolean literals
+        template<typename Char>
+        struct BoolLiterals;
+
+        template<>
+        struct BoolLiterals<char>
+        {
+            static const char* True() { return "true"; }
+            static const char* False() { return "false"; }
+        };
+
+        template<>
+        struct BoolLiterals<wchar_t>
+        {
+            static const wchar_t* True() { return L"true"; }
+            static const wchar_t* False() { return L"false"; }
+        };
+
+        //! Boolean engine, accepts "true", "false" and the numbers 0 and 1 as the stream reads them, without streams
+        template<typename Char>
+        struct BoolEngine
+        {
+            typedef std::basic_string<Char> String;
+
+            static bool Parse(const Char* data, std::size_t size, bool& result)
+            {
+                typedef BoolLiterals<Char> Literals;
+
+                if (size == 4 && std::equal(data, data + size, Literals::True()))
+                {
+                    result = true;
+                    return true;
+                }
+                if (size == 5 && std::equal(data, data + size, Literals::False()))
+                {
+                    result = false;
+                    return true;
+                }
+
+                // optional sign and leading zeros, minus only for zero
+                const Char* const end = data + size;
+                const bool negative = data != end && *data == Char('-');
+                if (data != end && (negative || *data == Char('+')))
+                    ++data;
+                while (end - data > 1 && *data == Char('0'))
+                    ++data;
+
+                if (end - data != 1 || (*data != Char('0') && (*data != Char('1') || negative)))
+                    return false;
+
+                result = *data == Char('1');
+                return true;
+            }
+
+            static String Format(const bool value)
+            {
+                typedef BoolLiterals<Char> Literals;
+                return value ? String(Literals::True(), 4) : String(Literals::False(), 5);
+            }
+        };
+
+        //! Bool parser, strings are matched directly, numbers are checked, other sources go through streams
+        template<typename Source, bool = IsNumeric<Source>::value>
+        struct BoolParser
+        {
+            static bool Parse(const Source& src)
+            {
+                return CastImpl<Boolean, Source>(src);
+            }
+        };
+
+        template<typename Source>
+        struct BoolParser<Source, true>
+        {
+            static bool Parse(const Source src)
+            {
+                return NumericCast<bool>(src);
+            }
+        };
+
+        template<typename Char>
+        struct BoolParser<std::basic_string<Char>, false>
+        {
+            static bool Parse(const std::basic_string<Char>& src)
+            {
+                bool result = false;
+                if (!BoolEngine<Char>::Parse(src.data(), src.size(), result))
+                    ThrowCast<std::basic_string<Char> >();
+                return result;
+            }
+        };
+
+        template<typename Char>
+        struct BoolParser<const Char*, false>
+        {
+            static bool Parse(const Char* src)
+            {
+                bool result = false;
+                if (!src || !BoolEngine<Char>::Parse(src, std::char_traits<Char>::length(src), result))
+                    ThrowCast<const Char*>();
+                return result;
+            }
+        };
+
+        template<typename Char>
+        struct BoolParser<Char*, false> : BoolParser<const Char*>
+        {
+        };
+
+        //! Bool formatter, strings are built from literals, numbers are converted directly, other targets go through streams
+        template<typename Target, bool = IsNumeric<Target>::value>
+        struct BoolFormatter
+        {
+            static Target Format(const bool src)
+            {
+                return CastImpl<Target, Boolean>(src);
+            }
+        };
+
+        template<typename Target>
+        struct BoolFormatter<Target, true>
+        {
+            static Target Format(const bool src)
+            {
+                return NumericCast<Target>(src);
+            }
+        };
+
+        template<typename Char>
+        struct BoolFormatter<std::basic_string<Char>, false>
+        {
+            static std::basic_string<Char> Format(const bool src)
+            {
+                return BoolEngine<Char>::Format(src);
+            }
+        };
+
+		//! Specialized bool help struct
+		template<typename Source>
+		struct Caster<bool, Source>
+		{
+            bool operator () (const Source& src)
+			{
+				return BoolParser<Source>::Parse(src);
+			}
+		};
+
+		//! Specialized bool help struct
+		template<typename Target>
+		struct Caster<Target, bool>
+		{
+            Target operator () (const bool src)
+			{
+				return BoolFormatter<Target>::Format(src);
+			}
+		};
+
+#ifndef CONVERSION_FLOAT_MAX_DIGITS10
+        //! Floating point formatting with the shortest round-trip representation
+        template<typename Char, typename Source>
+        struct FloatFormatter
+        {
+            std::basic_string<Char> operator () (const Source src)
+            {
+                char buffer[32];
+                const char* const end = grisu::Format(src, buffer);
+                return std::basic_string<Char>(static_cast<const char*>(buffer), end);
+            }
+
+            //! Replaces the contents of a string of any allocator
+            template<typename Result>
+            void Into(const Source src, Result& out)
+            {
+                char buffer[32];
+                const char* const end = grisu::Format(src, buffer);
+                out.assign(static_cast<const char*>(buffer), end);
+            }
+        };
+
+        //! Specialized float help struct
+        template<typename Char>
+        struct Caster<std::basic_string<Char>, float> : FloatFormatter<Char, float>
+        {
+        };
+
+        //! Specialized double help struct
+        template<typename Char>
+        struct Caster<std::basic_string<Char>, double> : FloatFormatter<Char, double>
+        {
+        };
+#endif // CONVERSION_FLOAT_MAX_DIGITS10
+
+        //! Specialized byte help struct
+        template<typename Source>
+        struct Caster<unsigned char, Source>
+        {
+            unsigned char operator () (const Source& src)
+            {
+                return NumericCast<unsigned char>(CastImpl<unsigned, Source>(src));
+            }
+        };
+
+        //! Specialized byte help struct
+        template<typename Target>
+        struct Caster<Target, unsigned char>
+        {
+            Target operator () (const unsigned char src)
+            {
+                return CastImpl<Target, unsigned>(src);
+            }
+        };
+
+        //! Specialized help struct - conversion bits from integer to vector
+        template<>
+        struct Caster<std::vector<unsigned>, unsigned>
+        {
+            std::vector<unsigned> operator () (const unsigned src)
+            {
+                std::vector<unsigned> result;
+                Into(src, result);
+                return result;
+            }
+
+            //! Replaces the contents of a vector of any allocator
+            template<typename Result>
+            void Into(const unsigned src, Result& out)
+            {
+                out.clear();
+                if (!src)
+                    return;
+
+                unsigned mask = 1;
+                unsigned counter = 0;
+                for (; mask; mask <<= 1, ++counter)
+                {
+                    if (src & mask)
+                        out.push_back(counter);
+                }
+            }
+        };
+
+        //! Specialized help struct - conversion vector of values to bits
+        template<>
+        struct Caster<unsigned, std::vector<unsigned>>
+        {
+            unsigned operator () (const std::vector<unsigned>& src)
+            {
+                unsigned result = 0;
+
+                if (src.empty())
+                    return result;
+
+                for (const unsigned bit : src)
+                    result |= 1 << bit;
+
+                return result;
+            }
+        };
+	} // namespace details
+} // namespace conv
+
+#endif // ConversionNumeric_h__
@@ -0,0 +1,256 @@
+#ifndef ConversionPipe_h__
+#define ConversionPipe_h__
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "conversion/details/caster.hpp"
+#include "conversion/text.hpp"
+#include "conversion/binary.hpp"
+
+namespace conv
+{
+    //! Characters of the source pipe hands to its first stage at a time
+    const std::size_t PipeBlockSize = 4096;
+
+	namespace details
+	{
+    namespace pipe
+    {
+        //! Where a block may end, Split returns how many leading units of the pending input can be converted
+        //! on their own, the rest waits for the next block
+        struct AnyUnits
+        {
+            template<typename Char>
+            std::size_t Split(const Char*, const std::size_t size) const
+            {
+                return size;
+            }
+
+            bool IsClosed() const
+            {
+                return false;
+            }
+        };
+
+        //! Groups of Size units, such as three bytes of a base64 quantum or two hex digits
+        template<std::size_t Size>
+        struct GroupUnits : AnyUnits
+        {
+            template<typename Char>
+            std::size_t Split(const Char*, const std::size_t size) const
+            {
+                return size - size % Size;
+            }
+        };
+
+        //! UTF-8 split where the decoders start a sequence, malformed input included, so a block decodes as the
+        //! whole text would. Past a byte below 0x80 they always do, from there sequences are followed as decoded
+        struct Utf8Units : AnyUnits
+        {
+            std::size_t Split(const char* data, const std::size_t size) const
+            {
+                std::size_t start = size;
+                while (start && static_cast<unsigned char>(data[start - 1]) >= 0x80)
+                    --start;
+
+                while (start < size)
+                {
+                    const unsigned char lead = static_cast<unsigned char>(data[start]);
+                    const int trail = lead < 0xC2 || lead > 0xF4 ? 0 : lead < 0xE0 ? 1 : lead < 0xF0 ? 2 : 3;
+
+                    // a unit that is not a continuation ends the sequence and is skipped with it
+                    std::size_t next = start + 1;
+                    for (int i = 0; i < trail; ++i)
+                    {
+                        if (next == size)
+                            return start;
+                        if ((static_cast<unsigned char>(data[next++]) & 0xC0) != 0x80)
+                            break;
+                    }
+                    start = next;
+                }
+                return size;
+            }
+        };
+
+        //! Wide units, UTF-32 splits anywhere
+        template<std::size_t Size = sizeof(wchar_t)>
+        struct WideUnits : AnyUnits
+        {
+        };
+
+        //! UTF-16 does not split after a leading surrogate, which is decoded together with the unit after it
+        template<>
+        struct WideUnits<2> : AnyUnits
+        {
+            std::size_t Split(const wchar_t* data, const std::size_t size) const
+            {
+                std::size_t start = size;
+                while (start && IsSurrogate(data[start - 1]))
+                    --start;
+
+                while (start < size)
+                {
+                    if (IsLeading(data[start]) && start + 1 == size)
+                        return start;
+                    start += IsLeading(data[start]) ? 2 : 1;
+                }
+                return size;
+            }
+
+        private:
+            static bool IsSurrogate(const wchar_t unit)
+            {
+                return unit >= 0xD800 && unit <= 0xDFFF;
+            }
+
+            static bool IsLeading(const wchar_t unit)
+            {
+                return unit >= 0xD800 && unit <= 0xDBFF;
+            }
+        };
+
+        //! Quanta of four characters, decoding stops at the first '=' so the stage takes nothing after it
+        class Base64Units : public GroupUnits<4>
+        {
+        public:
+            Base64Units() : m_Closed(false)
+            {
+            }
+
+            std::size_t Split(const char* data, const std::size_t size)
+            {
+                if (std::find(data, data + size, '=') == data + size)
+                    return GroupUnits<4>::Split(data, size);
+                m_Closed = true;
+                return size;
+            }
+
+            bool IsClosed() const
+            {
+                return m_Closed;
+            }
+
+        private:
+            bool m_Closed;
+        };
+
+        //! Units of the casters pipe can stream through, other stages would need the whole text at once
+        template<typename Target, typename From>
+        struct Units
+        {
+            static_assert(sizeof(Target) == 0, "conversion can not be split into blocks for pipe");
+        };
+
+        template<typename Target>
+        struct Units<Target, Ansi> { typedef AnyUnits Type; };
+        template<>
+        struct Units<Ansi, std::wstring> { typedef WideUnits<> Type; };
+        template<>
+        struct Units<std::string, std::wstring> { typedef WideUnits<> Type; };
+        template<>
+        struct Units<std::wstring, std::string> { typedef Utf8Units Type; };
+        template<typename Source>
+        struct Units<Base64, Source> { typedef GroupUnits<3> Type; };
+        template<typename Target>
+        struct Units<Target, Base64> { typedef Base64Units Type; };
+        template<>
+        struct Units<std::string, std::vector<char> > { typedef GroupUnits<3> Type; };
+        template<>
+        struct Units<std::string, std::vector<unsigned char> > { typedef GroupUnits<3> Type; };
+        template<>
+        struct Units<std::vector<char>, std::string> { typedef Base64Units Type; };
+        template<>
+        struct Units<std::vector<unsigned char>, std::string> { typedef Base64Units Type; };
+        template<typename Source>
+        struct Units<Hex, Source> { typedef AnyUnits Type; };
+        template<typename Target>
+        struct Units<Target, Hex> { typedef GroupUnits<2> Type; };
+
+        //! Stages of a pipe, every one keeps its pending input and its last output between blocks
+        template<typename... Tags>
+        class Pipeline;
+
+        template<typename From, typename To, typename... Rest>
+        class Pipeline<From, To, Rest...>
+        {
+        public:
+            typedef typename Pipeline<To, Rest...>::Result Result;
+
+            //! Converts what can be converted of the pending input and [first, last), everything when end is set
+            template<typename Iterator>
+            void Push(const Iterator first, const Iterator last, const bool end, Result& out)
+            {
+                if (m_Units.IsClosed())
+                {
+                    if (end)
+                        m_Next.Push(m_Output.end(), m_Output.end(), true, out);
+                    return;
+                }
+
+                m_Input.insert(m_Input.end(), first, last);
+                const std::size_t size = end ? m_Input.size() : m_Units.Split(m_Input.data(), m_Input.size());
+                if (!size && !end)
+                    return;
+
+                // the tail goes to the spare buffer, so neither of them gives its memory back
+                m_Pending.assign(m_Input.begin() + size, m_Input.end());
+                m_Input.resize(size);
+                stats::InvokeInto<Caster<To, From> >(m_Input, m_Output);
+                m_Input.swap(m_Pending);
+
+                m_Next.Push(m_Output.begin(), m_Output.end(), end, out);
+            }
+
+        private:
+            typedef typename TypeTraits<From>::Type Input;
+            typedef typename TypeTraits<To>::Type Output;
+
+            Input m_Input;
+            Input m_Pending;
+            Output m_Output;
+            typename Units<To, From>::Type m_Units;
+            Pipeline<To, Rest...> m_Next;
+        };
+
+        //! The end of a pipe appends to the result
+        template<typename Last>
+        class Pipeline<Last>
+        {
+        public:
+            typedef typename TypeTraits<Last>::Type Result;
+
+            template<typename Iterator>
+            void Push(const Iterator first, const Iterator last, const bool, Result& out)
+            {
+                out.insert(out.end(), first, last);
+            }
+        };
+    } // namespace pipe
+	} // namespace details
+
+    //! Chained cast function, pipe<Ansi, std::string, Base64>(src) is cast<Base64>(cast<std::string, Ansi>(src))
+    //! without the intermediate string. The source goes through the stages block by block, so they hold a few
+    //! blocks worth of data whatever the size of the source. The stages are the casters of the text and binary
+    //! tags and strings: Ansi, std::string, std::wstring, Base64, Hex, std::vector<char>. Errors throw as the
+    //! casters do
+    template<typename From, typename To, typename... Rest>
+    typename details::pipe::Pipeline<From, To, Rest...>::Result pipe(const typename details::TypeTraits<From>::Type& src, const std::size_t block = PipeBlockSize)
+    {
+        typedef details::pipe::Pipeline<From, To, Rest...> Pipeline;
+
+        Pipeline pipeline;
+        typename Pipeline::Result result;
+        result.reserve(src.size());
+        const std::size_t step = std::max<std::size_t>(block, 1);
+        for (std::size_t offset = 0; offset < src.size(); offset += step)
+            pipeline.Push(src.begin() + offset, src.begin() + std::min(offset + step, src.size()), false, result);
+        pipeline.Push(src.end(), src.end(), true, result);
+        return result;
+    }
+} // namespace conv
+
+#endif // ConversionPipe_h__
@@ -0,0 +1,30 @@
+#ifndef ConversionStats_h__
+#define ConversionStats_h__
+
+#include <string>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+
+namespace conv
+{
+    //! Counters of one Caster specialization
+    struct CasterStats
+    {
+        std::string Caster;
+        boost::uint64_t Calls;
+        boost::uint64_t Failures;
+        boost::uint64_t InputBytes;
+        boost::uint64_t OutputBytes;
+
+        //! Successful calls by latency, element i counts calls that took [2^i, 2^(i+1)) nanoseconds
+        std::vector<boost::uint64_t> Latency;
+    };
+
+    //! Counters of every Caster specialization called through cast() so far, summed over all threads
+    //! Always empty unless the library is built with CONVERSION_STATS
+    std::vector<CasterStats> stats();
+
+} // namespace conv
+
+#endif // ConversionStats_h__
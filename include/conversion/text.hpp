@@ -0,0 +1,110 @@
+#ifndef ConversionText_h__
+#define ConversionText_h__
+
+#include <sstream>
+#include <string>
+
+#include "conversion/numeric.hpp"
+
+namespace conv
+{
+    struct Ansi {};
+
+	namespace details
+	{
+        template<>
+        struct TypeTraits<Ansi>
+        {
+            typedef std::string Type;
+        };
+
+		//! Specialized unicode to utf8 struct
+		template<>
+		struct Caster<std::string, std::wstring>
+		{
+            std::string operator () (const std::wstring& src);
+
+            //! Replaces the contents of a string of std::allocator or conv::Allocator
+            template<typename Result>
+            typename boost::enable_if<IsCompiledInto<Result, std::string> >::type Into(const std::wstring& src, Result& out);
+		};
+
+		//! Specialized utf8 to unicode struct
+		template<>
+		struct Caster<std::wstring, std::string>
+		{
+            std::wstring operator () (const std::string& src);
+
+            //! Replaces the contents of a string of std::allocator or conv::Allocator
+            template<typename Result>
+            typename boost::enable_if<IsCompiledInto<Result, std::wstring> >::type Into(const std::string& src, Result& out);
+		};
+
+		//! Specialized unicode to utf8 help struct
+		template<>
+		struct Caster<std::string, const wchar_t*>
+		{
+            std::string operator () (const wchar_t* src);
+
+            //! Replaces the contents of a string of std::allocator or conv::Allocator
+            template<typename Result>
+            typename boost::enable_if<IsCompiledInto<Result, std::string> >::type Into(const wchar_t* src, Result& out);
+		};
+
+		//! Specialized utf8 to unicode help struct
+		template<>
+		struct Caster<std::wstring, const char*>
+		{
+            std::wstring operator () (const char* src);
+
+            //! Replaces the contents of a string of std::allocator or conv::Allocator
+            template<typename Result>
+            typename boost::enable_if<IsCompiledInto<Result, std::wstring> >::type Into(const char* src, Result& out);
+		};
+
+		//! Specialized ansi to utf8 help struct
+		template<>
+		struct Caster<std::string, Ansi>
+		{
+            std::string operator () (const std::string& src);
+
+            //! Replaces the contents of a string of std::allocator or conv::Allocator
+            template<typename Result>
+            typename boost::enable_if<IsCompiledInto<Result, std::string> >::type Into(const std::string& src, Result& out);
+		};
+
+		//! Specialized ansi to unicode help struct
+		template<>
+		struct Caster<std::wstring, Ansi>
+		{
+            std::wstring operator () (const std::string& src);
+
+            //! Replaces the contents of a string of std::allocator or conv::Allocator
+            template<typename Result>
+            typename boost::enable_if<IsCompiledInto<Result, std::wstring> >::type Into(const std::string& src, Result& out);
+		};
+
+		//! Specialized unicode to ansi help struct
+		template<>
+		struct Caster<Ansi, std::wstring>
+		{
+            std::string operator () (const std::wstring& src);
+
+            //! Replaces the contents of a string of std::allocator or conv::Allocator
+            template<typename Result>
+            typename boost::enable_if<IsCompiledInto<Result, std::string> >::type Into(const std::wstring& src, Result& out);
+		};
+
+        //! Specialized help struct - conversion string stream to string
+        template<>
+        struct Caster<std::string, std::stringstream>
+        {
+            std::string operator () (const std::stringstream& src)
+            {
+                return src.str();
+            }
+        };
+	} // namespace details
+} // namespace conv
+
+#endif // ConversionText_h__
@@ -0,0 +1,499 @@
+#ifndef ConversionTime_h__
+#define ConversionTime_h__
+
+#include <cstddef>
+#include <limits>
+#include <string>
+
+#include "conversion/cache.hpp"
+#include "conversion/epoch.hpp"
+#include "conversion/fixed.hpp"
+#include "conversion/numeric.hpp"
+#include "conversion/details/civil.hpp"
+
+#include <boost/cstdint.hpp>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+
+namespace conv
+{
+    //! Parses only %Y-%m-%dT%H:%M:%S%f with an optional trailing Z as before RFC 3339 support, without offsets
+    struct StrictTime {};
+
+    //! String holding epoch seconds, milliseconds, microseconds or nanoseconds, told apart by the digit count
+    //! (up to 10, 13, 16 and 19), decimal epoch seconds or an RFC 3339 timestamp
+    struct AnyTimestamp {};
+
+	namespace details
+	{
+        template<>
+        struct TypeTraits<StrictTime>
+        {
+            typedef boost::posix_time::ptime Type;
+        };
+
+        namespace epoch
+        {
+            typedef boost::int64_t Ticks;
+
+            //! Ticks per second of posix time, microseconds unless date_time is configured for nanoseconds
+            constexpr Ticks Resolution = boost::posix_time::time_duration::ticks_per_second();
+
+            //! Day number of 1970-01-01 in the gregorian calendar
+            constexpr boost::int64_t DayNumber = 2440588;
+
+#ifndef BOOST_DATE_TIME_POSIX_TIME_STD_CONFIG
+            //! Tick count of 1970-01-01 00:00:00
+            constexpr Ticks Origin = DayNumber * 86400 * Resolution;
+
+            //! Ticks since epoch of the first and the last instant of the calendar, 1400-01-01 to 9999-12-31
+            constexpr Ticks MinSince = civil::DaysFromCivil(civil::Date{ 1400, 1, 1 }) * civil::SecondsPerDay * Resolution;
+            constexpr Ticks MaxSince = civil::DaysFromCivil(civil::Date{ 10000, 1, 1 }) * civil::SecondsPerDay * Resolution - 1;
+
+            //! Reads tick count straight from the representation, posix time has no public accessor for it
+            struct Access : boost::posix_time::ptime
+            {
+                static Ticks Get(const boost::posix_time::ptime& src)
+                {
+                    return (src.*&Access::time_).time_count();
+                }
+            };
+
+            //! Special values take the top two and the bottom tick counts, adjacent when wrapped around
+            inline bool IsSpecial(const boost::posix_time::ptime& src)
+            {
+                const boost::uint64_t first = static_cast<boost::uint64_t>(std::numeric_limits<Ticks>::max() - 1);
+                return static_cast<boost::uint64_t>(Access::Get(src)) - first < 3;
+            }
+
+            //! Ticks since epoch
+            inline Ticks Since(const boost::posix_time::ptime& src)
+            {
+                return Access::Get(src) - Origin;
+            }
+
+            inline boost::posix_time::ptime Make(const Ticks since)
+            {
+                typedef boost::posix_time::ptime::time_rep_type Rep;
+                return boost::posix_time::ptime(Rep(Origin + since));
+            }
+
+            //! Days since epoch and ticks within the day
+            inline void Split(const boost::posix_time::ptime& src, boost::int64_t& days, Ticks& ticks)
+            {
+                const Ticks since = Since(src);
+                days = civil::FloorDiv(since, civil::SecondsPerDay * Resolution);
+                ticks = since - days * civil::SecondsPerDay * Resolution;
+            }
+#else
+            //! Nanosecond ticks since epoch end within the calendar, only the special values are left out
+            constexpr Ticks MinSince = std::numeric_limits<Ticks>::min() + 1;
+            constexpr Ticks MaxSince = std::numeric_limits<Ticks>::max() - 2;
+
+            //! Nanosecond configuration keeps date and time of day apart, go through date_time arithmetic
+            inline bool IsSpecial(const boost::posix_time::ptime& src)
+            {
+                return src.is_special();
+            }
+
+            inline Ticks Since(const boost::posix_time::ptime& src)
+            {
+                return (src - boost::posix_time::ptime(boost::gregorian::date(1970, 1, 1))).ticks();
+            }
+
+            inline boost::posix_time::ptime Make(const Ticks since)
+            {
+                return boost::posix_time::ptime(boost::gregorian::date(1970, 1, 1)) + boost::posix_time::time_duration(0, 0, 0, since);
+            }
+
+            //! Nanosecond ticks since epoch do not cover the whole calendar, go by day number and time of day
+            inline void Split(const boost::posix_time::ptime& src, boost::int64_t& days, Ticks& ticks)
+            {
+                days = static_cast<boost::int64_t>(src.date().day_number()) - DayNumber;
+                ticks = src.time_of_day().ticks();
+            }
+#endif // BOOST_DATE_TIME_POSIX_TIME_STD_CONFIG
+
+            //! Multiplication that wraps instead of overflowing, the callers check CanScale before using the result
+            inline Ticks Scale(const Ticks value, const Ticks factor)
+            {
+                return static_cast<Ticks>(static_cast<boost::uint64_t>(value) * static_cast<boost::uint64_t>(factor));
+            }
+
+            inline bool CanScale(const Ticks value, const Ticks factor)
+            {
+                return value <= std::numeric_limits<Ticks>::max() / factor && value >= std::numeric_limits<Ticks>::min() / factor;
+            }
+
+            //! Scales between ticks and units of PerSecond, coarser units truncate toward zero
+            //! Scaling up is valid only where FitsFromTicks / FitsToTicks hold
+            template<Ticks PerSecond, bool Finer = (PerSecond > Resolution)>
+            struct Unit
+            {
+                static Ticks FromTicks(const Ticks ticks) { return ticks / (Resolution / PerSecond); }
+                static Ticks ToTicks(const Ticks count) { return Scale(count, Resolution / PerSecond); }
+                static bool FitsFromTicks(const Ticks) { return true; }
+                static bool FitsToTicks(const Ticks count) { return CanScale(count, Resolution / PerSecond); }
+            };
+
+            template<Ticks PerSecond>
+            struct Unit<PerSecond, true>
+            {
+                static Ticks FromTicks(const Ticks ticks) { return Scale(ticks, PerSecond / Resolution); }
+                static Ticks ToTicks(const Ticks count) { return count / (PerSecond / Resolution); }
+                static bool FitsFromTicks(const Ticks ticks) { return CanScale(ticks, PerSecond / Resolution); }
+                static bool FitsToTicks(const Ticks) { return true; }
+            };
+
+            //! Whether the count of units fits Count and was scaled without overflow
+            template<typename Count, Ticks PerSecond>
+            bool IsCountInRange(const Ticks ticks, const Ticks count)
+            {
+                return Unit<PerSecond>::FitsFromTicks(ticks) && IsRepresentable<Count>(count, boost::true_type(), boost::true_type());
+            }
+
+            //! Posix time to count of units since epoch, special values and times the count can not hold throw
+            template<typename Count, Ticks PerSecond>
+            struct FromTime
+            {
+                Count operator () (const boost::posix_time::ptime& src)
+                {
+                    if (IsSpecial(src))
+                        ThrowCast<boost::posix_time::ptime>();
+
+                    const Ticks since = Since(src);
+                    const Ticks count = Unit<PerSecond>::FromTicks(since);
+                    if (!IsCountInRange<Count, PerSecond>(since, count))
+                        ThrowCast<boost::posix_time::ptime>();
+                    return static_cast<Count>(count);
+                }
+
+                //! Branch free loop, special values and counts out of range are checked once after it and throw with
+                //! the output already written
+                //! Accumulator is as wide as the ticks so the loop vectorizes wherever 64 bit compares do (SSE4.2, AVX2)
+                static void Batch(const boost::posix_time::ptime* first, const boost::posix_time::ptime* last, Count* out)
+                {
+                    const std::ptrdiff_t count = last - first;
+                    boost::uint64_t special = 0;
+                    for (std::ptrdiff_t i = 0; i < count; ++i)
+                    {
+                        const Ticks since = Since(first[i]);
+                        const Ticks units = Unit<PerSecond>::FromTicks(since);
+                        special |= IsSpecial(first[i]) | !IsCountInRange<Count, PerSecond>(since, units);
+                        out[i] = static_cast<Count>(units);
+                    }
+                    if (special)
+                        ThrowCast<boost::posix_time::ptime>();
+                }
+            };
+
+            //! Count of units since epoch to posix time, counts past the calendar throw
+            template<typename Count, Ticks PerSecond>
+            struct ToTime
+            {
+                boost::posix_time::ptime operator () (const Count& src)
+                {
+                    return Make(ToTicks(src));
+                }
+
+                static void Batch(const Count* first, const Count* last, boost::posix_time::ptime* out)
+                {
+                    for (; first != last; ++first, ++out)
+                        *out = Make(ToTicks(*first));
+                }
+
+            private:
+                static Ticks ToTicks(const Count src)
+                {
+                    if (!IsRepresentable<Ticks>(src, boost::true_type(), boost::true_type()))
+                        ThrowCast<Count>();
+
+                    const Ticks count = static_cast<Ticks>(src);
+                    const Ticks ticks = Unit<PerSecond>::ToTicks(count);
+                    if (!Unit<PerSecond>::FitsToTicks(count) || ticks < MinSince || ticks > MaxSince)
+                        ThrowCast<Count>();
+                    return ticks;
+                }
+            };
+
+            //! Duration to count of units, truncated toward zero, special values and durations the count can not
+            //! hold throw
+            template<typename Count, Ticks PerSecond>
+            struct FromDuration
+            {
+                Count operator () (const boost::posix_time::time_duration& src)
+                {
+                    if (src.is_special())
+                        ThrowCast<boost::posix_time::time_duration>();
+
+                    const Ticks count = Unit<PerSecond>::FromTicks(src.ticks());
+                    if (!IsCountInRange<Count, PerSecond>(src.ticks(), count))
+                        ThrowCast<boost::posix_time::time_duration>();
+                    return static_cast<Count>(count);
+                }
+            };
+
+            //! Count of units to duration, counts the ticks can not hold or that would land on a special value throw
+            template<typename Count, Ticks PerSecond>
+            struct ToDuration
+            {
+                boost::posix_time::time_duration operator () (const Count& src)
+                {
+                    const Ticks count = static_cast<Ticks>(src);
+                    const Ticks ticks = Unit<PerSecond>::ToTicks(count);
+                    if (!Unit<PerSecond>::FitsToTicks(count) || ticks == std::numeric_limits<Ticks>::min() || ticks >= std::numeric_limits<Ticks>::max() - 1)
+                        ThrowCast<Count>();
+                    return boost::posix_time::time_duration(0, 0, 0, ticks);
+                }
+            };
+        } // namespace epoch
+
+        //! Specialized help struct - conversion posix time to milliseconds since epoch
+        template<>
+        struct Caster<boost::uint64_t, boost::posix_time::ptime> : epoch::FromTime<boost::uint64_t, 1000>
+        {
+        };
+
+        //! Specialized help struct - conversion posix time to seconds since epoch
+        template<>
+        struct Caster<boost::uint32_t, boost::posix_time::ptime> : epoch::FromTime<boost::uint32_t, 1>
+        {
+        };
+
+        //! Specialized help struct - conversion posix time to microseconds since epoch
+        template<>
+        struct Caster<EpochMicroseconds, boost::posix_time::ptime> : epoch::FromTime<boost::uint64_t, 1000000>
+        {
+        };
+
+        //! Specialized help struct - conversion posix time to nanoseconds since epoch
+        template<>
+        struct Caster<EpochNanoseconds, boost::posix_time::ptime> : epoch::FromTime<boost::uint64_t, 1000000000>
+        {
+        };
+
+        //! Specialized help struct - conversion milliseconds since epoch to posix time
+        template<>
+        struct Caster<boost::posix_time::ptime, boost::uint64_t> : epoch::ToTime<boost::uint64_t, 1000>
+        {
+        };
+
+        //! Specialized help struct - conversion seconds since epoch to posix time
+        template<>
+        struct Caster<boost::posix_time::ptime, boost::uint32_t> : epoch::ToTime<boost::uint32_t, 1>
+        {
+        };
+
+        //! Specialized help struct - conversion microseconds since epoch to posix time
+        template<>
+        struct Caster<boost::posix_time::ptime, EpochMicroseconds> : epoch::ToTime<boost::uint64_t, 1000000>
+        {
+        };
+
+        //! Specialized help struct - conversion nanoseconds since epoch to posix time
+        template<>
+        struct Caster<boost::posix_time::ptime, EpochNanoseconds> : epoch::ToTime<boost::uint64_t, 1000000000>
+        {
+        };
+
+        //! Results the compiled Into of a time formatter is instantiated for, a string of std::allocator or Allocator or
+        //! the FixedString of Inline<T>
+        template<typename Result, typename T>
+        struct IsTextInto : boost::mpl::or_<IsCompiledInto<Result, std::string>, boost::is_same<Result, typename TypeTraits<Inline<T> >::Type> >
+        {
+        };
+
+        //! Specialized help struct - conversion posix time to string
+        template<>
+        struct Caster<std::string, boost::posix_time::ptime>
+        {
+            std::string operator () (const boost::posix_time::ptime& src);
+
+            //! Replaces the contents of a string of std::allocator or conv::Allocator, or of a FixedString
+            template<typename Result>
+            typename boost::enable_if<IsTextInto<Result, boost::posix_time::ptime> >::type Into(const boost::posix_time::ptime& src, Result& out);
+        };
+
+        //! Specialized help struct - conversion RFC 3339 string to UTC posix time, the offset may be omitted
+        //! The forms the date_time facet read still are: a date alone, a time without seconds, 24:00:00 and a dot without
+        //! digits or with text after them. Invalid input gives not_a_date_time
+        template<>
+        struct Caster<boost::posix_time::ptime, std::string>
+        {
+            boost::posix_time::ptime operator () (const std::string& src);
+        };
+
+        //! Specialized help struct - conversion string to posix time with the date_time facet
+        template<>
+        struct Caster<StrictTime, std::string>
+        {
+            boost::posix_time::ptime operator () (const std::string& src);
+        };
+
+        //! Specialized help struct - conversion timestamp of any supported form to UTC posix time, one pass and no exceptions
+        //! Invalid input gives not_a_date_time
+        template<>
+        struct Caster<boost::posix_time::ptime, AnyTimestamp>
+        {
+            boost::posix_time::ptime operator () (const std::string& src);
+
+            //! Column of timestamps, RFC 3339 ones reuse the date and hour of the previous as TimestampParser does
+            static void Batch(const std::string* first, const std::string* last, boost::posix_time::ptime* out);
+        };
+
+        //! AnyTimestamp only names the form of a source, cast<ptime, AnyTimestamp>(text)
+        template<typename Source>
+        struct Caster<AnyTimestamp, Source>
+        {
+            static_assert(sizeof(Source) == 0, "AnyTimestamp is not a target, use cast<ptime, AnyTimestamp>(text)");
+        };
+
+        //! Specialized help struct - conversion duration to string, [-]HH:MM:SS[.fraction] with hours not wrapped at a day
+        template<>
+        struct Caster<std::string, boost::posix_time::time_duration>
+        {
+            std::string operator () (const boost::posix_time::time_duration& src);
+
+            //! Replaces the contents of a string of std::allocator or conv::Allocator, or of a FixedString
+            template<typename Result>
+            typename boost::enable_if<IsTextInto<Result, boost::posix_time::time_duration> >::type Into(const boost::posix_time::time_duration& src, Result& out);
+        };
+
+        //! Specialized help struct - conversion string to duration, fraction digits past the resolution are truncated
+        template<>
+        struct Caster<boost::posix_time::time_duration, std::string>
+        {
+            boost::posix_time::time_duration operator () (const std::string& src);
+        };
+
+        //! Specialized help struct - conversion duration to milliseconds
+        template<>
+        struct Caster<boost::int64_t, boost::posix_time::time_duration> : epoch::FromDuration<boost::int64_t, 1000>
+        {
+        };
+
+        //! Specialized help struct - conversion duration to seconds
+        template<>
+        struct Caster<boost::int32_t, boost::posix_time::time_duration> : epoch::FromDuration<boost::int32_t, 1>
+        {
+        };
+
+        //! Specialized help struct - conversion milliseconds to duration
+        template<>
+        struct Caster<boost::posix_time::time_duration, boost::int64_t> : epoch::ToDuration<boost::int64_t, 1000>
+        {
+        };
+
+        //! Specialized help struct - conversion seconds to duration
+        template<>
+        struct Caster<boost::posix_time::time_duration, boost::int32_t> : epoch::ToDuration<boost::int32_t, 1>
+        {
+        };
+
+        //! Specialized help struct - conversion date to string, YYYY-MM-DD
+        template<>
+        struct Caster<std::string, boost::gregorian::date>
+        {
+            std::string operator () (const boost::gregorian::date& src);
+
+            //! Replaces the contents of a string of std::allocator or conv::Allocator, or of a FixedString
+            template<typename Result>
+            typename boost::enable_if<IsTextInto<Result, boost::gregorian::date> >::type Into(const boost::gregorian::date& src, Result& out);
+        };
+
+        //! Specialized help struct - conversion YYYY-MM-DD string to date
+        template<>
+        struct Caster<boost::gregorian::date, std::string>
+        {
+            boost::gregorian::date operator () (const std::string& src);
+        };
+
+        //! Specialized help struct - conversion date to days since epoch, special values throw
+        template<>
+        struct Caster<boost::int32_t, boost::gregorian::date>
+        {
+            boost::int32_t operator () (const boost::gregorian::date& src)
+            {
+                if (src.is_special())
+                    ThrowCast<boost::gregorian::date>();
+                return static_cast<boost::int32_t>(static_cast<boost::int64_t>(src.day_number()) - epoch::DayNumber);
+            }
+        };
+
+        //! Specialized help struct - conversion days since epoch to date, days outside of 1400-01-01 to 9999-12-31 throw
+        template<>
+        struct Caster<boost::gregorian::date, boost::int32_t>
+        {
+            boost::gregorian::date operator () (const boost::int32_t src)
+            {
+                if (src < civil::DaysFromCivil(civil::Date{ 1400, 1, 1 }) || src > civil::DaysFromCivil(civil::Date{ 9999, 12, 31 }))
+                    ThrowCast<boost::int32_t>();
+                return boost::gregorian::date(static_cast<boost::gregorian::date::date_int_type>(src + epoch::DayNumber));
+            }
+        };
+
+        //! Length of not-a-date-time, the longest special value
+        const std::size_t SpecialLength = 15;
+
+        //! YYYY-MM-DDTHH:MM:SS with a dot and the fraction digits of the resolution
+        template<>
+        struct InlineLength<boost::posix_time::ptime>
+        {
+            static const std::size_t Value = civil::DateTimeLength + DecimalDigits(epoch::Resolution);
+        };
+
+        //! Sign, hours up to the longest duration, :MM:SS, a dot and the fraction digits
+        template<>
+        struct InlineLength<boost::posix_time::time_duration>
+        {
+            static const std::size_t Value = 1 + DecimalDigits(std::numeric_limits<boost::int64_t>::max() / epoch::Resolution / 3600) + 6 + DecimalDigits(epoch::Resolution);
+        };
+
+        template<>
+        struct InlineLength<boost::gregorian::date>
+        {
+            static const std::size_t Value = civil::DateLength > SpecialLength ? civil::DateLength : SpecialLength;
+        };
+
+        //! ptime, time_duration and date hold a single count, CachedCaster keys them by its bytes
+        //! The nanosecond configuration keeps ptime as a padded date and time of day, it is not cached there
+#ifndef BOOST_DATE_TIME_POSIX_TIME_STD_CONFIG
+        template<>
+        struct CacheKey<boost::posix_time::ptime> : BytesCacheKey<boost::posix_time::ptime>
+        {
+            static_assert(sizeof(boost::posix_time::ptime) == sizeof(boost::int64_t), "ptime is expected to hold one tick count");
+        };
+#endif // BOOST_DATE_TIME_POSIX_TIME_STD_CONFIG
+
+        template<>
+        struct CacheKey<boost::posix_time::time_duration> : BytesCacheKey<boost::posix_time::time_duration>
+        {
+            static_assert(sizeof(boost::posix_time::time_duration) == sizeof(boost::int64_t), "time_duration is expected to hold one tick count");
+        };
+
+        template<>
+        struct CacheKey<boost::gregorian::date> : BytesCacheKey<boost::gregorian::date>
+        {
+            static_assert(sizeof(boost::gregorian::date) == sizeof(boost::uint32_t), "date is expected to hold one day number");
+        };
+	} // namespace details
+
+    //! Parses RFC 3339 timestamps as cast<ptime> does, for streams of increasing timestamps
+    //! Keeps the date and hour of the previous input and parses only minutes and below while they repeat
+    //! Not synchronized, use one parser per stream
+    class TimestampParser
+    {
+    public:
+        TimestampParser();
+
+        boost::posix_time::ptime operator () (const std::string& src);
+        boost::posix_time::ptime operator () (const char* begin, const char* end);
+
+    private:
+        //! YYYY-MM-DDTHH of the previous input
+        char m_Prefix[details::civil::DateHourLength];
+        boost::int64_t m_HourSeconds;
+        bool m_Cached;
+    };
+} // namespace conv
+
+#endif // ConversionTime_h__
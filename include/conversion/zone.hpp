@@ -0,0 +1,131 @@
+#ifndef ConversionZone_h__
+#define ConversionZone_h__
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "conversion/epoch.hpp"
+#include "conversion/time.hpp"
+#include "conversion/details/civil.hpp"
+
+#include <boost/cstdint.hpp>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+
+namespace conv
+{
+    //! Zone of the TZ environment variable, or /etc/localtime when it is not set
+    struct SystemZone
+    {
+        static const char* Name() { return nullptr; }
+    };
+
+    //! Tag of the local wall clock time in Zone, Zone::Name() gives the tzdata name such as "Europe/Moscow",
+    //! an absolute path to a TZif file or a POSIX TZ string such as "CET-1CEST,M3.5.0,M10.5.0/3"
+    template<typename Zone>
+    struct LocalTime {};
+
+	namespace details
+	{
+        template<typename Zone>
+        struct TypeTraits<LocalTime<Zone> >
+        {
+            typedef boost::posix_time::ptime Type;
+        };
+
+        namespace zone
+        {
+            //! UTC offsets of one zone, sorted by the UTC second each offset starts at
+            //! Rules of the zone are expanded into explicit transitions up to LastRuleYear
+            class Table
+            {
+            public:
+                //! Loads the zone from tzdata, throws CastException when it can not be found or read
+                explicit Table(const char* name);
+
+                //! Offset in seconds east of UTC at the UTC second
+                boost::int32_t Offset(const boost::int64_t seconds) const
+                {
+                    const std::vector<boost::int64_t>::const_iterator next = std::upper_bound(m_Starts.begin(), m_Starts.end(), seconds);
+                    return m_Offsets[next - m_Starts.begin() - 1];
+                }
+
+                //! Appends a transition, ignored when it does not change the offset or is not later than the last one
+                void Add(const boost::int64_t start, const boost::int32_t offset);
+
+            private:
+                std::vector<boost::int64_t> m_Starts;
+                std::vector<boost::int32_t> m_Offsets;
+            };
+
+            //! Year up to which daylight saving rules are expanded, later times keep the offset in effect at its end
+            const int LastRuleYear = 2100;
+
+            //! Table of the zone, loaded on the first use
+            template<typename Zone>
+            const Table& Get()
+            {
+                static const Table table(Zone::Name());
+                return table;
+            }
+
+            //! UTC posix time to the local wall clock, special values are kept
+            template<typename Zone>
+            boost::posix_time::ptime ToLocal(const boost::posix_time::ptime& src)
+            {
+                if (epoch::IsSpecial(src))
+                    return src;
+
+                const epoch::Ticks since = epoch::Since(src);
+                const boost::int32_t offset = Get<Zone>().Offset(civil::FloorDiv(since, epoch::Resolution));
+                return epoch::Make(since + offset * epoch::Resolution);
+            }
+
+            //! Converts the epoch count to UTC posix time first
+            template<typename Zone, typename Source>
+            struct FromEpoch
+            {
+                boost::posix_time::ptime operator () (const typename TypeTraits<Source>::Type& src)
+                {
+                    return ToLocal<Zone>(details::Caster<boost::posix_time::ptime, Source>()(src));
+                }
+            };
+        } // namespace zone
+
+        //! Specialized help struct - conversion UTC posix time to local time
+        template<typename Zone>
+        struct Caster<LocalTime<Zone>, boost::posix_time::ptime>
+        {
+            boost::posix_time::ptime operator () (const boost::posix_time::ptime& src)
+            {
+                return zone::ToLocal<Zone>(src);
+            }
+        };
+
+        //! Specialized help struct - conversion milliseconds since epoch to local time
+        template<typename Zone>
+        struct Caster<LocalTime<Zone>, boost::uint64_t> : zone::FromEpoch<Zone, boost::uint64_t>
+        {
+        };
+
+        //! Specialized help struct - conversion seconds since epoch to local time
+        template<typename Zone>
+        struct Caster<LocalTime<Zone>, boost::uint32_t> : zone::FromEpoch<Zone, boost::uint32_t>
+        {
+        };
+
+        //! Specialized help struct - conversion microseconds since epoch to local time
+        template<typename Zone>
+        struct Caster<LocalTime<Zone>, EpochMicroseconds> : zone::FromEpoch<Zone, EpochMicroseconds>
+        {
+        };
+
+        //! Specialized help struct - conversion nanoseconds since epoch to local time
+        template<typename Zone>
+        struct Caster<LocalTime<Zone>, EpochNanoseconds> : zone::FromEpoch<Zone, EpochNanoseconds>
+        {
+        };
+	} // namespace details
+} // namespace conv
+
+#endif // ConversionZone_h__
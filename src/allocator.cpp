@@ -0,0 +1,140 @@
+#include "conversion/allocator.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <new>
+
+namespace conv
+{
+namespace
+{
+
+class NewDelete : public MemoryResource
+{
+    void* DoAllocate(const std::size_t bytes, std::size_t) override
+    {
+        return ::operator new(bytes);
+    }
+
+    void DoDeallocate(void* p, std::size_t, std::size_t) override
+    {
+        ::operator delete(p);
+    }
+
+    bool DoIsEqual(const MemoryResource& other) const override
+    {
+        return this == &other;
+    }
+};
+
+//! Aligns the pointer up, null when the aligned block does not fit before end
+char* Align(char* current, const char* const end, const std::size_t bytes, const std::size_t alignment)
+{
+    if (!current)
+        return nullptr;
+
+    const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(current);
+    const std::size_t padding = (alignment - address % alignment) % alignment;
+    if (static_cast<std::size_t>(end - current) < padding || static_cast<std::size_t>(end - current) - padding < bytes)
+        return nullptr;
+    return current + padding;
+}
+
+} // namespace
+
+MemoryResource* NewDeleteResource()
+{
+    static NewDelete resource;
+    return &resource;
+}
+
+//! Header of a chunk taken from upstream, the memory handed out follows it
+struct MonotonicArena::Chunk
+{
+    Chunk* m_Next;
+    std::size_t m_Size;
+};
+
+MonotonicArena::MonotonicArena(const std::size_t initialSize, MemoryResource* upstream)
+    : m_Upstream(upstream)
+    , m_Buffer(nullptr)
+    , m_BufferSize(0)
+    , m_InitialSize(initialSize ? initialSize : 1)
+    , m_NextSize(m_InitialSize)
+    , m_Current(nullptr)
+    , m_End(nullptr)
+    , m_Chunks(nullptr)
+{
+}
+
+MonotonicArena::MonotonicArena(void* buffer, const std::size_t size, MemoryResource* upstream)
+    : m_Upstream(upstream)
+    , m_Buffer(static_cast<char*>(buffer))
+    , m_BufferSize(size)
+    , m_InitialSize(size ? size : 1)
+    , m_NextSize(m_InitialSize)
+    , m_Current(m_Buffer)
+    , m_End(m_Buffer + size)
+    , m_Chunks(nullptr)
+{
+}
+
+MonotonicArena::~MonotonicArena()
+{
+    Release();
+}
+
+void MonotonicArena::Release()
+{
+    while (m_Chunks)
+    {
+        Chunk* const next = m_Chunks->m_Next;
+        m_Upstream->Deallocate(m_Chunks, m_Chunks->m_Size, alignof(std::max_align_t));
+        m_Chunks = next;
+    }
+
+    m_NextSize = m_InitialSize;
+    m_Current = m_Buffer;
+    m_End = m_Buffer + m_BufferSize;
+}
+
+void* MonotonicArena::DoAllocate(const std::size_t bytes, const std::size_t alignment)
+{
+    if (char* const aligned = Align(m_Current, m_End, bytes, alignment))
+    {
+        m_Current = aligned + bytes;
+        return aligned;
+    }
+
+    // the next chunk doubles, and always holds the block with the worst padding after the header
+    const std::size_t needed = sizeof(Chunk) + alignment + bytes;
+    if (needed < bytes)
+        throw std::bad_alloc();
+    while (m_NextSize < needed)
+        m_NextSize = m_NextSize > std::numeric_limits<std::size_t>::max() / 2 ? needed : m_NextSize * 2;
+
+    Chunk* const chunk = static_cast<Chunk*>(m_Upstream->Allocate(m_NextSize, alignof(std::max_align_t)));
+    chunk->m_Next = m_Chunks;
+    chunk->m_Size = m_NextSize;
+    m_Chunks = chunk;
+
+    char* const begin = reinterpret_cast<char*>(chunk + 1);
+    m_End = reinterpret_cast<char*>(chunk) + m_NextSize;
+    if (m_NextSize <= std::numeric_limits<std::size_t>::max() / 2)
+        m_NextSize *= 2;
+
+    char* const aligned = Align(begin, m_End, bytes, alignment);
+    m_Current = aligned + bytes;
+    return aligned;
+}
+
+void MonotonicArena::DoDeallocate(void*, std::size_t, std::size_t)
+{
+}
+
+bool MonotonicArena::DoIsEqual(const MemoryResource& other) const
+{
+    return this == &other;
+}
+
+} // namespace conv
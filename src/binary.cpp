@@ -0,0 +1,141 @@
+#include "conversion/binary.hpp"
+#include "conversion/allocator.hpp"
+
+#include <boost/algorithm/hex.hpp>
+
+namespace conv
+{
+namespace details
+{
+
+template struct Caster<Base64, std::string>;
+template struct Caster<Base64, std::vector<char> >;
+template struct Caster<Base64, std::vector<unsigned char> >;
+
+template std::string Caster<std::string, Base64>::operator () (const std::string&);
+template std::vector<char> Caster<std::vector<char>, Base64>::operator () (const std::string&);
+template std::vector<unsigned char> Caster<std::vector<unsigned char>, Base64>::operator () (const std::string&);
+
+std::vector<char> Caster<std::vector<char>, std::string>::operator () (const std::string& src)
+{
+    return Caster<std::vector<char>, Base64>()(src);
+}
+
+template<typename Result>
+typename boost::enable_if<IsCompiledInto<Result, std::vector<char> > >::type Caster<std::vector<char>, std::string>::Into(const std::string& src, Result& out)
+{
+    Caster<std::vector<char>, Base64>().Into(src, out);
+}
+
+std::string Caster<std::string, std::vector<char>>::operator () (const std::vector<char>& src)
+{
+    return Caster<Base64, std::vector<char> >()(src);
+}
+
+template<typename Result>
+typename boost::enable_if<IsCompiledInto<Result, std::string> >::type Caster<std::string, std::vector<char>>::Into(const std::vector<char>& src, Result& out)
+{
+    Caster<Base64, std::vector<char> >().Into(src, out);
+}
+
+std::vector<unsigned char> Caster<std::vector<unsigned char>, std::string>::operator () (const std::string& src)
+{
+    return Caster<std::vector<unsigned char>, Base64>()(src);
+}
+
+template<typename Result>
+typename boost::enable_if<IsCompiledInto<Result, std::vector<unsigned char> > >::type Caster<std::vector<unsigned char>, std::string>::Into(const std::string& src, Result& out)
+{
+    Caster<std::vector<unsigned char>, Base64>().Into(src, out);
+}
+
+std::string Caster<std::string, std::vector<unsigned char>>::operator () (const std::vector<unsigned char>& src)
+{
+    return Caster<Base64, std::vector<unsigned char> >()(src);
+}
+
+template<typename Result>
+typename boost::enable_if<IsCompiledInto<Result, std::string> >::type Caster<std::string, std::vector<unsigned char>>::Into(const std::vector<unsigned char>& src, Result& out)
+{
+    Caster<Base64, std::vector<unsigned char> >().Into(src, out);
+}
+
+std::string Caster<Hex, std::vector<char>>::operator () (const std::vector<char>& src)
+{
+    std::string result;
+    Into(src, result);
+    return result;
+}
+
+template<typename Result>
+typename boost::enable_if<IsCompiledInto<Result, std::string> >::type Caster<Hex, std::vector<char>>::Into(const std::vector<char>& src, Result& out)
+{
+    out.clear();
+    out.reserve(src.size() * 2);
+    boost::algorithm::hex(src.begin(), src.end(), std::back_inserter(out));
+}
+
+std::vector<char> Caster<std::vector<char>, Hex>::operator () (const std::string& src)
+{
+    std::vector<char> data;
+    Into(src, data);
+    return data;
+}
+
+template<typename Result>
+typename boost::enable_if<IsCompiledInto<Result, std::vector<char> > >::type Caster<std::vector<char>, Hex>::Into(const std::string& src, Result& out)
+{
+    out.clear();
+    out.reserve(src.size() / 2);
+    boost::algorithm::unhex(src.begin(), src.end(), std::back_inserter(out));
+}
+
+std::string Caster<Hex, std::string>::operator () (const std::string& src)
+{
+    std::string result;
+    Into(src, result);
+    return result;
+}
+
+template<typename Result>
+typename boost::enable_if<IsCompiledInto<Result, std::string> >::type Caster<Hex, std::string>::Into(const std::string& src, Result& out)
+{
+    out.clear();
+    out.reserve(src.size() * 2);
+    boost::algorithm::hex(src.begin(), src.end(), std::back_inserter(out));
+}
+
+std::string Caster<std::string, Hex>::operator () (const std::string& src)
+{
+    std::string result;
+    Into(src, result);
+    return result;
+}
+
+template<typename Result>
+typename boost::enable_if<IsCompiledInto<Result, std::string> >::type Caster<std::string, Hex>::Into(const std::string& src, Result& out)
+{
+    out.clear();
+    out.reserve(src.size() / 2);
+    boost::algorithm::unhex(src.begin(), src.end(), std::back_inserter(out));
+}
+
+template void Caster<std::vector<char>, std::string>::Into(const std::string&, std::vector<char>&);
+template void Caster<std::vector<char>, std::string>::Into(const std::string&, Vector<char>&);
+template void Caster<std::string, std::vector<char>>::Into(const std::vector<char>&, std::string&);
+template void Caster<std::string, std::vector<char>>::Into(const std::vector<char>&, String&);
+template void Caster<std::vector<unsigned char>, std::string>::Into(const std::string&, std::vector<unsigned char>&);
+template void Caster<std::vector<unsigned char>, std::string>::Into(const std::string&, Vector<unsigned char>&);
+template void Caster<std::string, std::vector<unsigned char>>::Into(const std::vector<unsigned char>&, std::string&);
+template void Caster<std::string, std::vector<unsigned char>>::Into(const std::vector<unsigned char>&, String&);
+template void Caster<Hex, std::vector<char>>::Into(const std::vector<char>&, std::string&);
+template void Caster<Hex, std::vector<char>>::Into(const std::vector<char>&, String&);
+template void Caster<std::vector<char>, Hex>::Into(const std::string&, std::vector<char>&);
+template void Caster<std::vector<char>, Hex>::Into(const std::string&, Vector<char>&);
+template void Caster<Hex, std::string>::Into(const std::string&, std::string&);
+template void Caster<Hex, std::string>::Into(const std::string&, String&);
+template void Caster<std::string, Hex>::Into(const std::string&, std::string&);
+template void Caster<std::string, Hex>::Into(const std::string&, String&);
+
+} // namespace details
+} // namespace conv
@@ -0,0 +1,29 @@
+#include "conversion/details/caster.hpp"
+
+#include <boost/exception/errinfo_nested_exception.hpp>
+#include <boost/exception/errinfo_type_info_name.hpp>
+#include <boost/exception/detail/exception_ptr.hpp>
+#include <boost/throw_exception.hpp>
+
+namespace conv
+{
+namespace details
+{
+
+void ThrowCast(const std::type_info& source)
+{
+    BOOST_THROW_EXCEPTION(CastException()
+        << boost::errinfo_type_info_name(source.name())
+    );
+}
+
+void ThrowLexicalCast(const std::type_info& source, const std::type_info& target)
+{
+    BOOST_THROW_EXCEPTION(CastException()
+        << boost::errinfo_nested_exception(boost::copy_exception(boost::bad_lexical_cast(source, target)))
+        << boost::errinfo_type_info_name(source.name())
+    );
+}
+
+} // namespace details
+} // namespace conv
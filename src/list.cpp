@@ -0,0 +1,125 @@
+#include "conversion/list.hpp"
+#include "conversion/allocator.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace conv
+{
+namespace details
+{
+
+std::vector<boost::uint64_t> Caster<std::vector<boost::uint64_t>, std::string>::operator () (const std::string& src)
+{
+    std::vector<boost::uint64_t> result;
+    Into(src, result);
+    return result;
+}
+
+template<typename Result>
+typename boost::enable_if<IsCompiledInto<Result, std::vector<boost::uint64_t> > >::type Caster<std::vector<boost::uint64_t>, std::string>::Into(const std::string& src, Result& out)
+{
+    out.clear();
+    if (src.empty())
+        return;
+
+    const char* begin = src.data();
+    const char* const end = begin + src.size();
+    out.reserve(std::count(begin, end, ',') + 1);
+    for (;;)
+    {
+        const char* const comma = std::find(begin, end, ',');
+        boost::uint64_t value;
+        if (!integer::Parse(begin, comma, value))
+            ThrowCast<std::string>();
+        out.push_back(value);
+
+        if (comma == end)
+            return;
+        begin = comma + 1;
+    }
+}
+
+std::string Caster<std::string, std::vector<boost::uint64_t>>::operator () (const std::vector<boost::uint64_t>& src)
+{
+    std::string result;
+    Into(src, result);
+    return result;
+}
+
+template<typename Result>
+typename boost::enable_if<IsCompiledInto<Result, std::string> >::type Caster<std::string, std::vector<boost::uint64_t>>::Into(const std::vector<boost::uint64_t>& src, Result& out)
+{
+    out.clear();
+
+    char buffer[std::numeric_limits<boost::uint64_t>::digits10 + 2];
+    char* const end = buffer + sizeof(buffer);
+    for (std::size_t i = 0; i < src.size(); ++i)
+    {
+        if (i)
+            out.push_back(',');
+        out.append(integer::Format(src[i], end), end);
+    }
+}
+
+std::vector<std::string> Caster<std::vector<std::string>, std::string>::operator () (const std::string& src)
+{
+    std::vector<std::string> result;
+    Into(src, result);
+    return result;
+}
+
+template<typename Result>
+typename boost::enable_if<IsCompiledInto<Result, std::vector<std::string> > >::type Caster<std::vector<std::string>, std::string>::Into(const std::string& src, Result& out)
+{
+    const char* begin = src.data();
+    const char* const end = begin + src.size();
+    out.reserve(std::count(begin, end, ',') + 1);
+
+    // strings left from a previous value are refilled, keeping their capacity
+    std::size_t count = 0;
+    for (;; ++count)
+    {
+        const char* const comma = std::find(begin, end, ',');
+        if (count < out.size())
+            out[count].assign(begin, comma);
+        else
+            out.emplace_back(begin, comma);
+
+        if (comma == end)
+            break;
+        begin = comma + 1;
+    }
+    out.erase(out.begin() + count + 1, out.end());
+}
+
+std::string Caster<std::string, std::vector<std::string>>::operator () (const std::vector<std::string>& src)
+{
+    std::string result;
+    Into(src, result);
+    return result;
+}
+
+template<typename Result>
+typename boost::enable_if<IsCompiledInto<Result, std::string> >::type Caster<std::string, std::vector<std::string>>::Into(const std::vector<std::string>& src, Result& out)
+{
+    out.clear();
+    for (std::size_t i = 0; i < src.size(); ++i)
+    {
+        if (i)
+            out.push_back(',');
+        out.append(src[i].begin(), src[i].end());
+    }
+}
+
+template void Caster<std::vector<boost::uint64_t>, std::string>::Into(const std::string&, std::vector<boost::uint64_t>&);
+template void Caster<std::vector<boost::uint64_t>, std::string>::Into(const std::string&, Vector<boost::uint64_t>&);
+template void Caster<std::string, std::vector<boost::uint64_t>>::Into(const std::vector<boost::uint64_t>&, std::string&);
+template void Caster<std::string, std::vector<boost::uint64_t>>::Into(const std::vector<boost::uint64_t>&, String&);
+template void Caster<std::vector<std::string>, std::string>::Into(const std::string&, std::vector<std::string>&);
+template void Caster<std::vector<std::string>, std::string>::Into(const std::string&, Vector<String>&);
+template void Caster<std::string, std::vector<std::string>>::Into(const std::vector<std::string>&, std::string&);
+template void Caster<std::string, std::vector<std::string>>::Into(const std::vector<std::string>&, String&);
+
+} // namespace details
+} // namespace conv
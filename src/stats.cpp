@@ -0,0 +1,122 @@
+#include "conversion/stats.hpp"
+#include "conversion/details/stats.hpp"
+
+#ifdef CONVERSION_STATS
+
+#include <algorithm>
+#include <mutex>
+
+#include <boost/core/demangle.hpp>
+
+#endif // CONVERSION_STATS
+
+namespace conv
+{
+#ifdef CONVERSION_STATS
+
+namespace details
+{
+namespace stats
+{
+namespace
+{
+
+//! Registered specializations and counters of live and exited threads
+struct Registry
+{
+    std::mutex m_Mutex;
+    std::vector<std::string> m_Names;
+    std::vector<Block*> m_Threads;
+    std::vector<CasterStats> m_Exited;
+
+    static Registry& Instance()
+    {
+        // never destroyed, threads may exit after static destruction
+        static Registry* const registry = new Registry;
+        return *registry;
+    }
+};
+
+void Accumulate(const Counters& counters, CasterStats& result)
+{
+    result.Calls += counters.m_Calls.load(std::memory_order_relaxed);
+    result.Failures += counters.m_Failures.load(std::memory_order_relaxed);
+    result.InputBytes += counters.m_InputBytes.load(std::memory_order_relaxed);
+    result.OutputBytes += counters.m_OutputBytes.load(std::memory_order_relaxed);
+
+    result.Latency.resize(LatencyBuckets);
+    for (std::size_t i = 0; i < LatencyBuckets; ++i)
+        result.Latency[i] += counters.m_Latency[i].load(std::memory_order_relaxed);
+}
+
+} // namespace
+
+std::size_t Register(const std::type_info& caster)
+{
+    Registry& registry = Registry::Instance();
+    std::lock_guard<std::mutex> lock(registry.m_Mutex);
+
+    registry.m_Names.push_back(boost::core::demangle(caster.name()));
+    return registry.m_Names.size() - 1;
+}
+
+Block* Attach()
+{
+    Block* const block = new Block();
+
+    Registry& registry = Registry::Instance();
+    std::lock_guard<std::mutex> lock(registry.m_Mutex);
+    registry.m_Threads.push_back(block);
+    return block;
+}
+
+void Detach(Block* block)
+{
+    Registry& registry = Registry::Instance();
+    {
+        std::lock_guard<std::mutex> lock(registry.m_Mutex);
+
+        registry.m_Exited.resize(CONVERSION_STATS_MAX_CASTERS);
+        for (std::size_t i = 0; i < CONVERSION_STATS_MAX_CASTERS; ++i)
+            Accumulate(block->m_Casters[i], registry.m_Exited[i]);
+
+        registry.m_Threads.erase(std::remove(registry.m_Threads.begin(), registry.m_Threads.end(), block), registry.m_Threads.end());
+    }
+    delete block;
+}
+
+} // namespace stats
+} // namespace details
+
+std::vector<CasterStats> stats()
+{
+    using namespace details::stats;
+
+    Registry& registry = Registry::Instance();
+    std::lock_guard<std::mutex> lock(registry.m_Mutex);
+
+    std::vector<CasterStats> result(std::min<std::size_t>(registry.m_Names.size(), CONVERSION_STATS_MAX_CASTERS), CasterStats());
+    for (std::size_t i = 0; i < result.size(); ++i)
+    {
+        CasterStats& caster = result[i];
+        if (!registry.m_Exited.empty())
+            caster = registry.m_Exited[i];
+
+        caster.Caster = registry.m_Names[i];
+        caster.Latency.resize(LatencyBuckets);
+
+        for (const Block* block : registry.m_Threads)
+            Accumulate(block->m_Casters[i], caster);
+    }
+    return result;
+}
+
+#else
+
+std::vector<CasterStats> stats()
+{
+    return std::vector<CasterStats>();
+}
+
+#endif // CONVERSION_STATS
+} // namespace conv
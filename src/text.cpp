@@ -0,0 +1,300 @@
+#include "conversion/text.hpp"
+#include "conversion/allocator.hpp"
+
+#ifdef CONVERSION_WITHOUT_BOOST_LOCALE
+#include "conversion/details/utf.hpp"
+#else
+#pragma warning(push)
+#pragma warning(disable:4244) // 'argument' : conversion from 'boost::locale::utf::code_point' to 'const wchar_t', possible loss of data
+#include <boost/locale/encoding.hpp>
+#pragma warning(pop)
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+#endif
+
+namespace conv
+{
+namespace details
+{
+
+#ifdef CONVERSION_WITHOUT_BOOST_LOCALE
+
+template<typename Result>
+typename boost::enable_if<IsCompiledInto<Result, std::string> >::type Caster<std::string, std::wstring>::Into(const std::wstring& src, Result& out)
+{
+    out.clear();
+    out.reserve(src.size());
+    utf::WideToUtf8(src.begin(), src.end(), out);
+}
+
+template<typename Result>
+typename boost::enable_if<IsCompiledInto<Result, std::wstring> >::type Caster<std::wstring, std::string>::Into(const std::string& src, Result& out)
+{
+    out.clear();
+    out.reserve(src.size());
+    utf::Utf8ToWide(src.begin(), src.end(), out);
+}
+
+template<typename Result>
+typename boost::enable_if<IsCompiledInto<Result, std::string> >::type Caster<std::string, const wchar_t*>::Into(const wchar_t* src, Result& out)
+{
+    out.clear();
+    if (!src)
+        return;
+
+    const wchar_t* const end = src + std::char_traits<wchar_t>::length(src);
+    out.reserve(end - src);
+    utf::WideToUtf8(src, end, out);
+}
+
+template<typename Result>
+typename boost::enable_if<IsCompiledInto<Result, std::wstring> >::type Caster<std::wstring, const char*>::Into(const char* src, Result& out)
+{
+    out.clear();
+    if (!src)
+        return;
+
+    const char* const end = src + std::char_traits<char>::length(src);
+    out.reserve(end - src);
+    utf::Utf8ToWide(src, end, out);
+}
+
+template<typename Result>
+typename boost::enable_if<IsCompiledInto<Result, std::string> >::type Caster<std::string, Ansi>::Into(const std::string& src, Result& out)
+{
+    out.clear();
+    out.reserve(src.size());
+    utf::Cp1251ToUtf8(src.begin(), src.end(), out);
+}
+
+template<typename Result>
+typename boost::enable_if<IsCompiledInto<Result, std::wstring> >::type Caster<std::wstring, Ansi>::Into(const std::string& src, Result& out)
+{
+    out.clear();
+    out.reserve(src.size());
+    utf::Cp1251ToWide(src.begin(), src.end(), out);
+}
+
+template<typename Result>
+typename boost::enable_if<IsCompiledInto<Result, std::string> >::type Caster<Ansi, std::wstring>::Into(const std::wstring& src, Result& out)
+{
+    out.clear();
+    out.reserve(src.size());
+    utf::WideToCp1251(src.begin(), src.end(), out);
+}
+
+#else
+
+namespace
+{
+
+//! Upper half of cp1251 as resolved by Boost.Locale, 0 marks undefined bytes
+//! Built once, charset resolution on every call serializes the threads
+struct Cp1251Table
+{
+    boost::uint32_t toUnicode[0x80];
+    std::vector<std::pair<boost::uint32_t, char> > fromUnicode;
+
+    Cp1251Table()
+    {
+        for (unsigned i = 0; i < 0x80; ++i)
+        {
+            const std::wstring decoded = boost::locale::conv::to_utf<wchar_t>(std::string(1, static_cast<char>(0x80 + i)), "cp1251");
+            toUnicode[i] = decoded.size() == 1 ? static_cast<boost::uint32_t>(decoded[0]) : 0;
+            if (toUnicode[i])
+                fromUnicode.push_back(std::make_pair(toUnicode[i], static_cast<char>(0x80 + i)));
+        }
+        std::sort(fromUnicode.begin(), fromUnicode.end());
+    }
+
+    static const Cp1251Table& Instance()
+    {
+        static const Cp1251Table instance;
+        return instance;
+    }
+};
+
+//! Same as boost::locale::conv::utf_to_utf, skipping invalid sequences, into any string
+template<typename In, typename Result>
+void Transcode(const In* in, const In* const end, Result& out)
+{
+    typedef typename Result::value_type Char;
+
+    out.reserve(end - in);
+    while (in != end)
+    {
+        const boost::locale::utf::code_point cp = boost::locale::utf::utf_traits<In>::decode(in, end);
+        if (cp != boost::locale::utf::illegal && cp != boost::locale::utf::incomplete)
+            boost::locale::utf::utf_traits<Char>::encode(cp, std::back_inserter(out));
+    }
+}
+
+template<typename Result>
+void FromCp1251(const std::string& src, Result& out)
+{
+    typedef typename Result::value_type Char;
+
+    const Cp1251Table& table = Cp1251Table::Instance();
+
+    out.reserve(src.size());
+    for (const char c : src)
+    {
+        const unsigned char byte = static_cast<unsigned char>(c);
+        const boost::uint32_t cp = byte < 0x80 ? byte : table.toUnicode[byte - 0x80];
+        if (cp || !byte)
+            boost::locale::utf::utf_traits<Char>::encode(cp, std::back_inserter(out));
+    }
+}
+
+template<typename Result>
+void ToCp1251(const std::wstring& src, Result& out)
+{
+    const Cp1251Table& table = Cp1251Table::Instance();
+
+    out.reserve(src.size());
+
+    std::wstring::const_iterator it = src.begin();
+    while (it != src.end())
+    {
+        const boost::locale::utf::code_point cp = boost::locale::utf::utf_traits<wchar_t>::decode(it, src.end());
+        if (cp == boost::locale::utf::illegal || cp == boost::locale::utf::incomplete)
+            continue;
+
+        if (cp < 0x80)
+        {
+            out.push_back(static_cast<char>(cp));
+            continue;
+        }
+
+        const std::vector<std::pair<boost::uint32_t, char> >::const_iterator found = std::lower_bound(
+            table.fromUnicode.begin(), table.fromUnicode.end(), cp,
+            [](const std::pair<boost::uint32_t, char>& entry, const boost::uint32_t value) { return entry.first < value; });
+        if (found != table.fromUnicode.end() && found->first == cp)
+            out.push_back(found->second);
+    }
+}
+
+} // namespace
+
+template<typename Result>
+typename boost::enable_if<IsCompiledInto<Result, std::string> >::type Caster<std::string, std::wstring>::Into(const std::wstring& src, Result& out)
+{
+    out.clear();
+    Transcode(src.data(), src.data() + src.size(), out);
+}
+
+template<typename Result>
+typename boost::enable_if<IsCompiledInto<Result, std::wstring> >::type Caster<std::wstring, std::string>::Into(const std::string& src, Result& out)
+{
+    out.clear();
+    Transcode(src.data(), src.data() + src.size(), out);
+}
+
+template<typename Result>
+typename boost::enable_if<IsCompiledInto<Result, std::string> >::type Caster<std::string, const wchar_t*>::Into(const wchar_t* src, Result& out)
+{
+    out.clear();
+    if (src)
+        Transcode(src, src + std::char_traits<wchar_t>::length(src), out);
+}
+
+template<typename Result>
+typename boost::enable_if<IsCompiledInto<Result, std::wstring> >::type Caster<std::wstring, const char*>::Into(const char* src, Result& out)
+{
+    out.clear();
+    if (src)
+        Transcode(src, src + std::char_traits<char>::length(src), out);
+}
+
+template<typename Result>
+typename boost::enable_if<IsCompiledInto<Result, std::string> >::type Caster<std::string, Ansi>::Into(const std::string& src, Result& out)
+{
+    out.clear();
+    FromCp1251(src, out);
+}
+
+template<typename Result>
+typename boost::enable_if<IsCompiledInto<Result, std::wstring> >::type Caster<std::wstring, Ansi>::Into(const std::string& src, Result& out)
+{
+    out.clear();
+    FromCp1251(src, out);
+}
+
+template<typename Result>
+typename boost::enable_if<IsCompiledInto<Result, std::string> >::type Caster<Ansi, std::wstring>::Into(const std::wstring& src, Result& out)
+{
+    out.clear();
+    ToCp1251(src, out);
+}
+
+#endif // CONVERSION_WITHOUT_BOOST_LOCALE
+
+std::string Caster<std::string, std::wstring>::operator () (const std::wstring& src)
+{
+    std::string result;
+    Into(src, result);
+    return result;
+}
+
+std::wstring Caster<std::wstring, std::string>::operator () (const std::string& src)
+{
+    std::wstring result;
+    Into(src, result);
+    return result;
+}
+
+std::string Caster<std::string, const wchar_t*>::operator () (const wchar_t* src)
+{
+    std::string result;
+    Into(src, result);
+    return result;
+}
+
+std::wstring Caster<std::wstring, const char*>::operator () (const char* src)
+{
+    std::wstring result;
+    Into(src, result);
+    return result;
+}
+
+std::string Caster<std::string, Ansi>::operator () (const std::string& src)
+{
+    std::string result;
+    Into(src, result);
+    return result;
+}
+
+std::wstring Caster<std::wstring, Ansi>::operator () (const std::string& src)
+{
+    std::wstring result;
+    Into(src, result);
+    return result;
+}
+
+std::string Caster<Ansi, std::wstring>::operator () (const std::wstring& src)
+{
+    std::string result;
+    Into(src, result);
+    return result;
+}
+
+template void Caster<std::string, std::wstring>::Into(const std::wstring&, std::string&);
+template void Caster<std::string, std::wstring>::Into(const std::wstring&, String&);
+template void Caster<std::wstring, std::string>::Into(const std::string&, std::wstring&);
+template void Caster<std::wstring, std::string>::Into(const std::string&, WString&);
+template void Caster<std::string, const wchar_t*>::Into(const wchar_t*, std::string&);
+template void Caster<std::string, const wchar_t*>::Into(const wchar_t*, String&);
+template void Caster<std::wstring, const char*>::Into(const char*, std::wstring&);
+template void Caster<std::wstring, const char*>::Into(const char*, WString&);
+template void Caster<std::string, Ansi>::Into(const std::string&, std::string&);
+template void Caster<std::string, Ansi>::Into(const std::string&, String&);
+template void Caster<std::wstring, Ansi>::Into(const std::string&, std::wstring&);
+template void Caster<std::wstring, Ansi>::Into(const std::string&, WString&);
+template void Caster<Ansi, std::wstring>::Into(const std::wstring&, std::string&);
+template void Caster<Ansi, std::wstring>::Into(const std::wstring&, String&);
+
+} // namespace details
+} // namespace conv
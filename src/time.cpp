@@ -0,0 +1,355 @@
+#include "conversion/time.hpp"
+#include "conversion/allocator.hpp"
+
+#include <cstring>
+#include <limits>
+#include <sstream>
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+namespace conv
+{
+namespace details
+{
+
+namespace
+{
+
+//! Text of special values, null for the others
+template<typename T>
+const char* SpecialName(const T& src)
+{
+    if (!src.is_special())
+        return nullptr;
+    return src.is_pos_infinity() ? "+infinity" : src.is_neg_infinity() ? "-infinity" : "not-a-date-time";
+}
+
+//! Reads the text of a special value as written by SpecialName
+bool ReadSpecial(const std::string& src, boost::date_time::special_values& value)
+{
+    if (src.empty() || (src[0] != '+' && src[0] != '-' && src[0] != 'n'))
+        return false;
+
+    value = src == "+infinity" ? boost::date_time::pos_infin : src == "-infinity" ? boost::date_time::neg_infin :
+        src == "not-a-date-time" ? boost::date_time::not_a_date_time : boost::date_time::not_special;
+    return value != boost::date_time::not_special;
+}
+
+//! Writes ticks within a second with a leading dot, nothing when they are zero
+char* WriteTicks(const boost::int64_t ticks, char* out)
+{
+    if (!ticks)
+        return out;
+    *out++ = '.';
+    return integer::WriteFixed(ticks, boost::posix_time::time_duration::num_fractional_digits(), out);
+}
+
+const boost::int64_t g_MinDays = civil::DaysFromCivil(civil::Date{ 1400, 1, 1 });
+const boost::int64_t g_MinSeconds = g_MinDays * civil::SecondsPerDay;
+const boost::int64_t g_MaxSeconds = (civil::DaysFromCivil(civil::Date{ 9999, 12, 31 }) + 1) * civil::SecondsPerDay - 1;
+
+//! Longest duration in whole seconds, the top tick counts are taken by special values
+const boost::int64_t g_MaxDurationSeconds = std::numeric_limits<boost::int64_t>::max() / epoch::Resolution - 1;
+
+} // namespace
+
+std::string Caster<std::string, boost::posix_time::ptime>::operator () (const boost::posix_time::ptime& src)
+{
+    std::string result;
+    Into(src, result);
+    return result;
+}
+
+template<typename Result>
+typename boost::enable_if<IsTextInto<Result, boost::posix_time::ptime> >::type Caster<std::string, boost::posix_time::ptime>::Into(const boost::posix_time::ptime& src, Result& out)
+{
+    if (const char* special = SpecialName(src))
+    {
+        out.assign(special);
+        return;
+    }
+
+    boost::int64_t days;
+    epoch::Ticks ticks;
+    epoch::Split(src, days, ticks);
+
+    // YYYY-MM-DDTHH:MM:SS.fffffffff
+    char buffer[32];
+    char* end = civil::WriteDateTime(civil::CivilFromDays(days), ticks / epoch::Resolution, buffer);
+    end = WriteTicks(ticks % epoch::Resolution, end);
+    out.assign(buffer, end);
+}
+
+std::string Caster<std::string, boost::posix_time::time_duration>::operator () (const boost::posix_time::time_duration& src)
+{
+    std::string result;
+    Into(src, result);
+    return result;
+}
+
+template<typename Result>
+typename boost::enable_if<IsTextInto<Result, boost::posix_time::time_duration> >::type Caster<std::string, boost::posix_time::time_duration>::Into(const boost::posix_time::time_duration& src, Result& out)
+{
+    if (const char* special = SpecialName(src))
+    {
+        out.assign(special);
+        return;
+    }
+
+    const boost::int64_t count = src.ticks();
+    const boost::uint64_t ticks = count < 0 ? 0 - static_cast<boost::uint64_t>(count) : static_cast<boost::uint64_t>(count);
+
+    char buffer[48];
+    char* end = buffer;
+    if (count < 0)
+        *end++ = '-';
+    end = civil::WriteClock(ticks / epoch::Resolution, end);
+    end = WriteTicks(static_cast<boost::int64_t>(ticks % epoch::Resolution), end);
+    out.assign(buffer, end);
+}
+
+boost::posix_time::time_duration Caster<boost::posix_time::time_duration, std::string>::operator () (const std::string& src)
+{
+    boost::date_time::special_values special;
+    if (ReadSpecial(src, special))
+        return boost::posix_time::time_duration(special);
+
+    const char* in = src.data();
+    const char* const end = in + src.size();
+
+    bool negative;
+    boost::int64_t seconds, nanoseconds;
+    if (!civil::ReadClock(in, end, negative, seconds) || !civil::ReadTail(in, end, false, nanoseconds) || seconds > g_MaxDurationSeconds)
+        ThrowCast<std::string>();
+
+    const boost::int64_t ticks = seconds * epoch::Resolution + nanoseconds / (1000000000 / epoch::Resolution);
+    return boost::posix_time::time_duration(0, 0, 0, negative ? -ticks : ticks);
+}
+
+std::string Caster<std::string, boost::gregorian::date>::operator () (const boost::gregorian::date& src)
+{
+    std::string result;
+    Into(src, result);
+    return result;
+}
+
+template<typename Result>
+typename boost::enable_if<IsTextInto<Result, boost::gregorian::date> >::type Caster<std::string, boost::gregorian::date>::Into(const boost::gregorian::date& src, Result& out)
+{
+    if (const char* special = SpecialName(src))
+    {
+        out.assign(special);
+        return;
+    }
+
+    char buffer[civil::DateLength];
+    const char* const end = civil::WriteDate(civil::CivilFromDays(static_cast<boost::int64_t>(src.day_number()) - epoch::DayNumber), buffer);
+    out.assign(static_cast<const char*>(buffer), end);
+}
+
+template void Caster<std::string, boost::posix_time::ptime>::Into(const boost::posix_time::ptime&, std::string&);
+template void Caster<std::string, boost::posix_time::ptime>::Into(const boost::posix_time::ptime&, String&);
+template void Caster<std::string, boost::posix_time::ptime>::Into(const boost::posix_time::ptime&, TypeTraits<Inline<boost::posix_time::ptime> >::Type&);
+template void Caster<std::string, boost::posix_time::time_duration>::Into(const boost::posix_time::time_duration&, std::string&);
+template void Caster<std::string, boost::posix_time::time_duration>::Into(const boost::posix_time::time_duration&, String&);
+template void Caster<std::string, boost::posix_time::time_duration>::Into(const boost::posix_time::time_duration&, TypeTraits<Inline<boost::posix_time::time_duration> >::Type&);
+template void Caster<std::string, boost::gregorian::date>::Into(const boost::gregorian::date&, std::string&);
+template void Caster<std::string, boost::gregorian::date>::Into(const boost::gregorian::date&, String&);
+template void Caster<std::string, boost::gregorian::date>::Into(const boost::gregorian::date&, TypeTraits<Inline<boost::gregorian::date> >::Type&);
+
+boost::gregorian::date Caster<boost::gregorian::date, std::string>::operator () (const std::string& src)
+{
+    boost::date_time::special_values special;
+    if (ReadSpecial(src, special))
+        return boost::gregorian::date(special);
+
+    boost::int64_t days;
+    if (src.size() != civil::DateLength || !civil::ReadDate(src.data(), days) || days < g_MinDays)
+        ThrowCast<std::string>();
+
+    return boost::gregorian::date(static_cast<boost::gregorian::date::date_int_type>(days + epoch::DayNumber));
+}
+
+namespace
+{
+
+//! Parsing stream with the time facet, built once per thread since constructing locales serializes on the global one
+struct TimeInput
+{
+    std::istringstream stream;
+
+    TimeInput()
+    {
+        stream.imbue(std::locale(std::locale::classic(), new boost::posix_time::time_input_facet("%Y-%m-%dT%H:%M:%S%f")));
+    }
+};
+
+//! Reads Z, z or a +HH:MM / -HH:MM offset in seconds, nothing at the end means UTC
+bool ReadOffset(const char* in, const char* const end, boost::int64_t& offset)
+{
+    offset = 0;
+    if (in == end)
+        return true;
+
+    if (*in == 'Z' || *in == 'z')
+        return in + 1 == end;
+
+    unsigned hours, minutes;
+    if (end - in != 6 || (*in != '+' && *in != '-') || !integer::ReadFixed(in + 1, 2, hours) || in[3] != ':' ||
+        !integer::ReadFixed(in + 4, 2, minutes) || hours > 23 || minutes > 59)
+        return false;
+
+    offset = (*in == '-' ? -1 : 1) * boost::int64_t(hours * 3600 + minutes * 60);
+    return true;
+}
+
+//! Seconds and nanoseconds since epoch as posix time, not_a_date_time outside 1400-01-01 to 9999-12-31
+boost::posix_time::ptime MakeInCalendar(const boost::int64_t seconds, const boost::int64_t nanoseconds)
+{
+    if (seconds < g_MinSeconds || seconds > g_MaxSeconds)
+        return boost::posix_time::ptime();
+
+    return epoch::Make(seconds * epoch::Resolution + nanoseconds / (1000000000 / epoch::Resolution));
+}
+
+//! Reads :MM:SS[.fraction][offset] following YYYY-MM-DDTHH, which is given in seconds since epoch
+//! Also takes :MM alone and the lenient fraction of the date_time facet
+boost::posix_time::ptime ReadMinutesToEnd(const char* in, const char* const end, const boost::int64_t hourSeconds)
+{
+    boost::int64_t minutes;
+    if (civil::ReadMinutesOnly(in, end, minutes))
+        return MakeInCalendar(hourSeconds + minutes, 0);
+
+    if (end - in < 6 || !civil::ReadMinutes(in, minutes, true))
+        return boost::posix_time::ptime();
+    in += 6;
+
+    boost::int64_t nanoseconds = 0;
+    if (in != end && *in == '.')
+        civil::ReadLenientFraction(++in, end, nanoseconds);
+
+    boost::int64_t offset;
+    if (!ReadOffset(in, end, offset))
+        return boost::posix_time::ptime();
+
+    return MakeInCalendar(hourSeconds + minutes - offset, nanoseconds);
+}
+
+//! Reads RFC 3339 timestamp, a date alone as its midnight and 24:00:00 as the midnight after the date
+boost::posix_time::ptime ReadTimestamp(const char* const begin, const char* const end)
+{
+    boost::int64_t days, seconds;
+    if (end - begin == civil::DateLength)
+        return civil::ReadDate(begin, days) ? MakeInCalendar(days * civil::SecondsPerDay, 0) : boost::posix_time::ptime();
+
+    if (end - begin < civil::DateHourLength)
+        return boost::posix_time::ptime();
+
+    if (civil::ReadDateHour(begin, seconds, true))
+        return ReadMinutesToEnd(begin + civil::DateHourLength, end, seconds);
+
+    return civil::ReadEndOfDay(begin, end, seconds) ? MakeInCalendar(seconds, 0) : boost::posix_time::ptime();
+}
+
+//! Tells epoch counts from decimal epoch seconds and RFC 3339 timestamps by one scan of the leading digits,
+//! the timestamps are handed over to text
+template<typename Text>
+boost::posix_time::ptime ReadAnyTimestamp(const char* const begin, const char* const end, Text& text)
+{
+    boost::uint64_t count = 0;
+    const char* in = begin;
+    for (; in != end && in - begin < 19; ++in)
+    {
+        const unsigned digit = static_cast<unsigned>(*in) - '0';
+        if (digit > 9)
+            break;
+        count = count * 10 + digit;
+    }
+
+    const std::ptrdiff_t digits = in - begin;
+    if (in == end)
+    {
+        if (!digits || count > static_cast<boost::uint64_t>(std::numeric_limits<epoch::Ticks>::max()))
+            return boost::posix_time::ptime();
+
+        const epoch::Ticks value = static_cast<epoch::Ticks>(count);
+        if (digits <= 10)
+            return epoch::Make(epoch::Unit<1>::ToTicks(value));
+        if (digits <= 13)
+            return epoch::Make(epoch::Unit<1000>::ToTicks(value));
+        if (digits <= 16)
+            return epoch::Make(epoch::Unit<1000000>::ToTicks(value));
+        return epoch::Make(epoch::Unit<1000000000>::ToTicks(value));
+    }
+
+    if (*in == '.' && digits && digits <= 10)
+    {
+        boost::int64_t nanoseconds;
+        if (!civil::ReadFraction(++in, end, nanoseconds) || in != end)
+            return boost::posix_time::ptime();
+        return epoch::Make(static_cast<epoch::Ticks>(count) * epoch::Resolution + nanoseconds / (1000000000 / epoch::Resolution));
+    }
+
+    return digits == 4 && *in == '-' ? text(begin, end) : boost::posix_time::ptime();
+}
+
+} // namespace
+
+boost::posix_time::ptime Caster<boost::posix_time::ptime, std::string>::operator () (const std::string& src)
+{
+    return ReadTimestamp(src.data(), src.data() + src.size());
+}
+
+boost::posix_time::ptime Caster<boost::posix_time::ptime, AnyTimestamp>::operator () (const std::string& src)
+{
+    return ReadAnyTimestamp(src.data(), src.data() + src.size(), ReadTimestamp);
+}
+
+void Caster<boost::posix_time::ptime, AnyTimestamp>::Batch(const std::string* first, const std::string* last, boost::posix_time::ptime* out)
+{
+    TimestampParser parser;
+    for (; first != last; ++first, ++out)
+        *out = ReadAnyTimestamp(first->data(), first->data() + first->size(), parser);
+}
+
+boost::posix_time::ptime Caster<StrictTime, std::string>::operator () (const std::string& src)
+{
+    static thread_local TimeInput input;
+
+    input.stream.clear();
+    input.stream.str((!src.empty() && src.back() == 'Z') ? src.substr(0, src.size() - 1) : src);
+
+    boost::posix_time::ptime pt;
+    input.stream >> pt;
+    return pt;
+}
+
+} // namespace details
+
+TimestampParser::TimestampParser() : m_HourSeconds(0), m_Cached(false)
+{
+}
+
+boost::posix_time::ptime TimestampParser::operator () (const std::string& src)
+{
+    return (*this)(src.data(), src.data() + src.size());
+}
+
+boost::posix_time::ptime TimestampParser::operator () (const char* const begin, const char* const end)
+{
+    // a date alone and 24:00:00 have no hour to keep
+    if (end - begin < details::civil::DateHourLength)
+        return details::ReadTimestamp(begin, end);
+
+    if (!m_Cached || std::memcmp(begin, m_Prefix, sizeof(m_Prefix)))
+    {
+        m_Cached = details::civil::ReadDateHour(begin, m_HourSeconds, true);
+        if (!m_Cached)
+            return details::ReadTimestamp(begin, end);
+        std::memcpy(m_Prefix, begin, sizeof(m_Prefix));
+    }
+
+    return details::ReadMinutesToEnd(begin + details::civil::DateHourLength, end, m_HourSeconds);
+}
+
+} // namespace conv
@@ -0,0 +1,371 @@
+#include "conversion/zone.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+
+#include <boost/exception/errinfo_file_name.hpp>
+#include <boost/exception/info.hpp>
+#include <boost/throw_exception.hpp>
+
+//! Directory of the tzdata files, the TZDIR environment variable takes precedence
+#ifndef CONVERSION_TZDIR
+#define CONVERSION_TZDIR "/usr/share/zoneinfo"
+#endif
+
+namespace conv
+{
+namespace details
+{
+namespace zone
+{
+namespace
+{
+
+const boost::int64_t g_Beginning = std::numeric_limits<boost::int64_t>::min();
+
+//! Day of a POSIX TZ rule: Jn counts days 1-365 without February 29, n counts days 0-365, Mm.w.d is weekday d of week w in month m
+struct RuleDay
+{
+    char m_Kind;
+    int m_Month;
+    int m_Week;
+    int m_Day;
+
+    //! Local time of the day the rule switches at
+    boost::int32_t m_Time;
+};
+
+//! POSIX TZ string such as CET-1CEST,M3.5.0,M10.5.0/3, offsets are east of UTC unlike in the string
+struct Rule
+{
+    boost::int32_t m_Standard;
+    boost::int32_t m_Daylight;
+    bool m_HasDaylight;
+    RuleDay m_Start;
+    RuleDay m_End;
+};
+
+bool ReadName(const char*& in)
+{
+    if (*in == '<')
+    {
+        const char* const end = std::strchr(in, '>');
+        if (!end)
+            return false;
+        in = end + 1;
+        return true;
+    }
+
+    const char* const begin = in;
+    while ((*in >= 'a' && *in <= 'z') || (*in >= 'A' && *in <= 'Z'))
+        ++in;
+    return in - begin >= 3;
+}
+
+bool ReadNumber(const char*& in, const int maxDigits, int& value)
+{
+    const char* const begin = in;
+    value = 0;
+    while (in - begin < maxDigits && *in >= '0' && *in <= '9')
+        value = value * 10 + (*in++ - '0');
+    return in != begin;
+}
+
+//! [+|-]hh[:mm[:ss]], hours up to 167 as allowed for the rule times
+bool ReadTime(const char*& in, boost::int32_t& seconds)
+{
+    const bool negative = *in == '-';
+    if (*in == '-' || *in == '+')
+        ++in;
+
+    int hours, minutes = 0, second = 0;
+    if (!ReadNumber(in, 3, hours) || hours > 167)
+        return false;
+    if (*in == ':' && (!ReadNumber(++in, 2, minutes) || minutes > 59))
+        return false;
+    if (*in == ':' && (!ReadNumber(++in, 2, second) || second > 59))
+        return false;
+
+    seconds = (negative ? -1 : 1) * (hours * 3600 + minutes * 60 + second);
+    return true;
+}
+
+bool ReadRuleDay(const char*& in, RuleDay& day)
+{
+    day.m_Time = 2 * 3600;
+    day.m_Month = day.m_Week = day.m_Day = 0;
+
+    if (*in == 'M')
+    {
+        day.m_Kind = 'M';
+        if (!ReadNumber(++in, 2, day.m_Month) || day.m_Month < 1 || day.m_Month > 12 || *in != '.' ||
+            !ReadNumber(++in, 1, day.m_Week) || day.m_Week < 1 || day.m_Week > 5 || *in != '.' ||
+            !ReadNumber(++in, 1, day.m_Day) || day.m_Day > 6)
+            return false;
+    }
+    else if (*in == 'J')
+    {
+        day.m_Kind = 'J';
+        if (!ReadNumber(++in, 3, day.m_Day) || day.m_Day < 1 || day.m_Day > 365)
+            return false;
+    }
+    else
+    {
+        day.m_Kind = 'D';
+        if (!ReadNumber(in, 3, day.m_Day) || day.m_Day > 365)
+            return false;
+    }
+
+    return *in != '/' || ReadTime(++in, day.m_Time);
+}
+
+bool ParseRule(const char* in, Rule& rule)
+{
+    boost::int32_t offset;
+    if (!ReadName(in) || !ReadTime(in, offset))
+        return false;
+
+    rule.m_Standard = -offset;
+    rule.m_Daylight = rule.m_Standard;
+    rule.m_HasDaylight = *in != '\0';
+    if (!rule.m_HasDaylight)
+        return true;
+
+    if (!ReadName(in))
+        return false;
+
+    rule.m_Daylight = rule.m_Standard + 3600;
+    if (*in != ',' && *in != '\0')
+    {
+        if (!ReadTime(in, offset))
+            return false;
+        rule.m_Daylight = -offset;
+    }
+
+    // without the switch days POSIX leaves the rules to the implementation, take the US ones as glibc does
+    static const char* const defaults = ",M3.2.0,M11.1.0";
+    const char* days = *in ? in : defaults;
+    if (*days != ',' || !ReadRuleDay(++days, rule.m_Start) || *days != ',' || !ReadRuleDay(++days, rule.m_End))
+        return false;
+    return *days == '\0';
+}
+
+//! Days since epoch of the rule day in the year
+boost::int64_t DayOfYear(const RuleDay& day, const boost::int64_t year)
+{
+    const boost::int64_t first = civil::DaysFromCivil(civil::Date{ year, 1, 1 });
+    switch (day.m_Kind)
+    {
+    case 'J':
+        return first + day.m_Day - 1 + (civil::IsLeap(year) && day.m_Day >= 60 ? 1 : 0);
+    case 'D':
+        return first + day.m_Day;
+    default:
+        {
+            const boost::int64_t month = civil::DaysFromCivil(civil::Date{ year, static_cast<unsigned>(day.m_Month), 1 });
+            const int weekday = static_cast<int>(month + 4 - civil::FloorDiv(month + 4, 7) * 7);
+            int offset = (day.m_Day - weekday + 7) % 7 + (day.m_Week - 1) * 7;
+            while (offset >= static_cast<int>(civil::DaysInMonth(year, day.m_Month)))
+                offset -= 7;
+            return month + offset;
+        }
+    }
+}
+
+//! Switch to daylight saving and back in UTC seconds for the year
+struct Switch
+{
+    Switch(const Rule& rule, const boost::int64_t year)
+        : m_Daylight(DayOfYear(rule.m_Start, year) * civil::SecondsPerDay + rule.m_Start.m_Time - rule.m_Standard)
+        , m_Standard(DayOfYear(rule.m_End, year) * civil::SecondsPerDay + rule.m_End.m_Time - rule.m_Daylight)
+    {
+    }
+
+    boost::int64_t m_Daylight;
+    boost::int64_t m_Standard;
+};
+
+//! Appends daylight saving transitions of the rule after the UTC second, no earlier than the first year of posix time
+//! A switch that is not earlier than the opposite one of the next year is dropped, so 0/0,J365/25 keeps daylight saving all year
+void Expand(const Rule& rule, const boost::int64_t from, Table& table)
+{
+    if (!rule.m_HasDaylight)
+        return;
+
+    const boost::int64_t first = civil::DaysFromCivil(civil::Date{ 1400, 1, 1 }) * civil::SecondsPerDay;
+    const boost::int64_t start = std::max(from, first);
+    boost::int64_t year = civil::CivilFromDays(civil::FloorDiv(start, civil::SecondsPerDay)).m_Year - 1;
+    for (Switch current(rule, year); year <= LastRuleYear; ++year)
+    {
+        const Switch next(rule, year + 1);
+        if (current.m_Daylight < current.m_Standard)
+        {
+            table.Add(current.m_Daylight, rule.m_Daylight);
+            if (current.m_Standard < next.m_Daylight)
+                table.Add(current.m_Standard, rule.m_Standard);
+        }
+        else
+        {
+            table.Add(current.m_Standard, rule.m_Standard);
+            if (current.m_Daylight < next.m_Standard)
+                table.Add(current.m_Daylight, rule.m_Daylight);
+        }
+        current = next;
+    }
+}
+
+//! Big endian signed integer
+boost::int64_t ReadBig(const unsigned char* in, const int size)
+{
+    boost::uint64_t value = 0;
+    for (int i = 0; i < size; ++i)
+        value = (value << 8) | in[i];
+    const int unused = 64 - size * 8;
+    return unused ? static_cast<boost::int64_t>(value << unused) >> unused : static_cast<boost::int64_t>(value);
+}
+
+//! TZif file as described in RFC 8536, the 64 bit block and the footer rule of version 2 and later are preferred
+bool Load(const std::string& data, Table& table)
+{
+    const unsigned char* const begin = reinterpret_cast<const unsigned char*>(data.data());
+    const unsigned char* const end = begin + data.size();
+    const std::size_t header = 44;
+
+    const unsigned char* in = begin;
+    int timeSize = 4;
+    for (;;)
+    {
+        if (static_cast<std::size_t>(end - in) < header || std::memcmp(in, "TZif", 4))
+            return false;
+
+        const boost::int64_t isUtCount = ReadBig(in + 20, 4);
+        const boost::int64_t isStdCount = ReadBig(in + 24, 4);
+        const boost::int64_t leapCount = ReadBig(in + 28, 4);
+        const boost::int64_t timeCount = ReadBig(in + 32, 4);
+        const boost::int64_t typeCount = ReadBig(in + 36, 4);
+        const boost::int64_t charCount = ReadBig(in + 40, 4);
+        if (isUtCount < 0 || isStdCount < 0 || leapCount < 0 || timeCount < 0 || typeCount < 1 || charCount < 0)
+            return false;
+
+        const boost::int64_t size = timeCount * timeSize + timeCount + typeCount * 6 + charCount + leapCount * (timeSize + 4) + isStdCount + isUtCount;
+        if (end - in - static_cast<boost::int64_t>(header) < size)
+            return false;
+
+        if (timeSize == 4 && in[4] >= '2')
+        {
+            in += header + size;
+            timeSize = 8;
+            continue;
+        }
+
+        const unsigned char* const times = in + header;
+        const unsigned char* const indices = times + timeCount * timeSize;
+        const unsigned char* const types = indices + timeCount;
+
+        table.Add(g_Beginning, static_cast<boost::int32_t>(ReadBig(types, 4)));
+        for (boost::int64_t i = 0; i < timeCount; ++i)
+        {
+            if (indices[i] >= typeCount)
+                return false;
+            table.Add(ReadBig(times + i * timeSize, timeSize), static_cast<boost::int32_t>(ReadBig(types + indices[i] * 6, 4)));
+        }
+
+        if (timeSize == 4)
+            return true;
+
+        // footer rule for the times after the last transition
+        const char* const footer = reinterpret_cast<const char*>(in + header + size);
+        const char* const footerEnd = reinterpret_cast<const char*>(end);
+        if (footer == footerEnd || *footer != '\n')
+            return true;
+
+        const char* const newline = std::find(footer + 1, footerEnd, '\n');
+        if (newline == footerEnd)
+            return false;
+
+        const std::string text(footer + 1, newline);
+        Rule rule;
+        if (text.empty())
+            return true;
+        if (!ParseRule(text.c_str(), rule))
+            return false;
+
+        Expand(rule, timeCount ? ReadBig(times + (timeCount - 1) * timeSize, timeSize) : g_Beginning, table);
+        return true;
+    }
+}
+
+bool ReadFile(const std::string& path, std::string& data)
+{
+    std::ifstream file(path.c_str(), std::ios::binary);
+    if (!file)
+        return false;
+    data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return !file.bad();
+}
+
+} // namespace
+
+Table::Table(const char* name)
+{
+    std::string path = "/etc/localtime";
+    if (!name)
+    {
+        name = std::getenv("TZ");
+        if (name && *name == ':')
+            ++name;
+        if (name && !*name)
+            name = "UTC0";
+    }
+
+    if (name)
+    {
+        const char* const directory = std::getenv("TZDIR");
+        path = *name == '/' ? std::string(name) : std::string(directory && *directory ? directory : CONVERSION_TZDIR) + '/' + name;
+    }
+
+    std::string data;
+    if (ReadFile(path, data))
+    {
+        if (Load(data, *this))
+            return;
+        m_Starts.clear();
+        m_Offsets.clear();
+    }
+
+    Rule rule;
+    if (name && ParseRule(name, rule))
+    {
+        Add(g_Beginning, rule.m_Standard);
+        Expand(rule, g_Beginning, *this);
+        return;
+    }
+
+    BOOST_THROW_EXCEPTION(CastException()
+        << boost::errinfo_file_name(path)
+    );
+}
+
+void Table::Add(const boost::int64_t start, const boost::int32_t offset)
+{
+    if (m_Starts.empty())
+    {
+        m_Starts.push_back(g_Beginning);
+        m_Offsets.push_back(offset);
+        return;
+    }
+
+    if (start <= m_Starts.back() || offset == m_Offsets.back())
+        return;
+
+    m_Starts.push_back(start);
+    m_Offsets.push_back(offset);
+}
+
+} // namespace zone
+} // namespace details
+} // namespace conv
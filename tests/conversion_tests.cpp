@@ -1,5 +1,18 @@
 #include "conversion/cast.hpp"
 
+#include <boost/core/demangle.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
 // Google test library headers
 #include <gtest/gtest.h>
 
@@ -61,6 +74,51 @@ TEST(Conversion, Enum)
     EXPECT_EQ(conv::cast<Foo>("1"), Second);
 }
 
+enum class Small : unsigned char
+{
+    Low = 1,
+    High = 200
+};
+
+TEST(Conversion, Numeric)
+{
+    EXPECT_EQ(conv::cast<int>(Second), 1);
+    EXPECT_EQ(conv::cast<Foo>(true), Second);
+    EXPECT_EQ(conv::cast<int>(true), 1);
+    EXPECT_EQ(conv::cast<long long>(1234567890), 1234567890LL);
+    EXPECT_EQ(conv::cast<int>(2.0), 2);
+    EXPECT_EQ(conv::cast<double>(1.5f), 1.5);
+    EXPECT_EQ(conv::cast<float>(0.1), 0.1f);
+    EXPECT_EQ(conv::cast<unsigned char>(255), 255);
+    EXPECT_FALSE(conv::cast<bool>(0));
+
+    EXPECT_THROW(conv::cast<short>(100000), conv::CastException);
+    EXPECT_THROW(conv::cast<unsigned>(-1), conv::CastException);
+    EXPECT_THROW(conv::cast<int>(-1U), conv::CastException);
+    EXPECT_THROW(conv::cast<int>(2.5), conv::CastException);
+    EXPECT_THROW(conv::cast<int>(1e10), conv::CastException);
+    EXPECT_THROW(conv::cast<float>(1e300), conv::CastException);
+    EXPECT_THROW(conv::cast<unsigned char>(256), conv::CastException);
+    EXPECT_THROW(conv::cast<unsigned char>("300"), conv::CastException);
+    EXPECT_THROW(conv::cast<bool>(2), conv::CastException);
+
+    EXPECT_EQ(conv::cast<Small>("200"), Small::High);
+    EXPECT_EQ(conv::cast<Small>(1), Small::Low);
+    EXPECT_EQ(conv::cast<std::string>(Small::High), "200");
+    EXPECT_EQ(conv::cast<int>(Small::High), 200);
+    EXPECT_THROW(conv::cast<Small>(300), conv::CastException);
+    EXPECT_THROW(conv::cast<Small>("256"), conv::CastException);
+
+    // characters are text, not numbers
+    EXPECT_EQ(conv::cast<int>('5'), 5);
+    EXPECT_EQ(conv::cast<unsigned char>('5'), 5);
+    EXPECT_EQ(conv::cast<Foo>('1'), Second);
+    EXPECT_TRUE(conv::cast<bool>('1'));
+    EXPECT_EQ(conv::cast<char>(7), '7');
+    EXPECT_THROW(conv::cast<char>(65), conv::CastException);
+    EXPECT_THROW(conv::cast<wchar_t>(65), conv::CastException);
+}
+
 TEST(Conversion, Unicode)
 {
 	const std::wstring wide = L"Unicode wide";
@@ -82,6 +140,33 @@ TEST(Conversion, Unicode)
 	EXPECT_EQ(testWideFromAnsi, L"And ansi now");
 }
 
+TEST(Conversion, Cyrillic)
+{
+    const std::wstring wide = L"\x041F\x0440\x0438\x0432\x0435\x0442 \x2116\x0401";
+    const std::string utf8 = "\xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82 \xE2\x84\x96\xD0\x81";
+    const std::string ansi = "\xCF\xF0\xE8\xE2\xE5\xF2 \xB9\xA8";
+
+    EXPECT_EQ(conv::cast<std::string>(wide), utf8);
+    EXPECT_EQ(conv::cast<std::wstring>(utf8), wide);
+    EXPECT_EQ(conv::cast<conv::Ansi>(wide), ansi);
+    const std::wstring wideFromAnsi = conv::cast<std::wstring, conv::Ansi>(ansi);
+    EXPECT_EQ(wideFromAnsi, wide);
+    const std::string utf8FromAnsi = conv::cast<std::string, conv::Ansi>(ansi);
+    EXPECT_EQ(utf8FromAnsi, utf8);
+
+    const std::wstring supplementary(1, static_cast<wchar_t>(0x1F600));
+    if (sizeof(wchar_t) == 4)
+    {
+        const std::string encoded = "\xF0\x9F\x98\x80";
+        EXPECT_EQ(conv::cast<std::string>(supplementary), encoded);
+        EXPECT_EQ(conv::cast<std::wstring>(encoded), supplementary);
+    }
+
+    // malformed input and characters missing from the code page are skipped
+    EXPECT_EQ(conv::cast<std::wstring>(std::string("a\xFF" "b\xC0\xAF" "c")), L"abc");
+    EXPECT_EQ(conv::cast<conv::Ansi>(std::wstring(L"a\x4E2D" L"b")), "ab");
+}
+
 TEST(Conversion, Types)
 {
 	const int value = 1234567890;
@@ -99,7 +184,11 @@ TEST(Conversion, Types)
 	EXPECT_THROW(conv::cast<bool>(L"not_a_bool"), conv::CastException);
 
 	const std::string floatAsString = conv::cast<std::string>(0.1234567891f);
+#ifdef CONVERSION_FLOAT_MAX_DIGITS10
 	EXPECT_EQ(floatAsString, "0.123456791");
+#else
+	EXPECT_EQ(floatAsString, "0.12345679");
+#endif
 
 	EXPECT_EQ(conv::cast<float>(L"0.123456791"), 0.1234567891f);
 	EXPECT_THROW(conv::cast<float>(L"not_a_float"), conv::CastException);
@@ -112,6 +201,59 @@ TEST(Conversion, Types)
     EXPECT_EQ(charValue, charConverted);
 }
 
+TEST(Conversion, Bool)
+{
+    EXPECT_EQ(conv::cast<std::string>(true), "true");
+    EXPECT_EQ(conv::cast<std::wstring>(false), L"false");
+
+    EXPECT_TRUE(conv::cast<bool>("true"));
+    EXPECT_TRUE(conv::cast<bool>("1"));
+    EXPECT_FALSE(conv::cast<bool>(L"false"));
+    EXPECT_FALSE(conv::cast<bool>(L"0"));
+    EXPECT_TRUE(conv::cast<bool>(std::string("true")));
+
+    const char* const text = "false";
+    EXPECT_FALSE(conv::cast<bool>(text));
+
+    // numbers are read as the stream reads them
+    EXPECT_TRUE(conv::cast<bool>("01"));
+    EXPECT_TRUE(conv::cast<bool>("+1"));
+    EXPECT_FALSE(conv::cast<bool>(L"-0"));
+
+    EXPECT_THROW(conv::cast<bool>(""), conv::CastException);
+    EXPECT_THROW(conv::cast<bool>("-1"), conv::CastException);
+    EXPECT_THROW(conv::cast<bool>("+"), conv::CastException);
+    EXPECT_THROW(conv::cast<bool>("True"), conv::CastException);
+    EXPECT_THROW(conv::cast<bool>("2"), conv::CastException);
+    EXPECT_THROW(conv::cast<bool>(L"flase"), conv::CastException);
+    EXPECT_THROW(conv::cast<bool>(std::wstring(L"true ")), conv::CastException);
+}
+
+TEST(Conversion, Float)
+{
+#ifndef CONVERSION_FLOAT_MAX_DIGITS10
+    EXPECT_EQ(conv::cast<std::string>(0.1), "0.1");
+    EXPECT_EQ(conv::cast<std::string>(0.3f), "0.3");
+    EXPECT_EQ(conv::cast<std::wstring>(-2.5), L"-2.5");
+    EXPECT_EQ(conv::cast<std::string>(100.0), "100");
+    EXPECT_EQ(conv::cast<std::string>(0.0001), "0.0001");
+    EXPECT_EQ(conv::cast<std::string>(1.5e-5), "1.5e-05");
+    EXPECT_EQ(conv::cast<std::string>(1e16), "10000000000000000");
+    EXPECT_EQ(conv::cast<std::string>(1e17), "1e+17");
+    EXPECT_EQ(conv::cast<std::string>(1e300), "1e+300");
+    EXPECT_EQ(conv::cast<std::string>(0.0), "0");
+    EXPECT_EQ(conv::cast<std::string>(std::numeric_limits<double>::infinity()), "inf");
+#endif
+
+    const double values[] = {1.0 / 3, 5e-324, 1.7976931348623157e308, 123456.789, 2.2250738585072014e-308};
+    for (const double value : values)
+        EXPECT_EQ(value, conv::cast<double>(conv::cast<std::string>(value)));
+
+    const float floats[] = {1.0f / 3, 1e-45f, 3.4028235e38f, 16777217.0f, 1.17549435e-38f};
+    for (const float value : floats)
+        EXPECT_EQ(value, conv::cast<float>(conv::cast<std::string>(value)));
+}
+
 TEST(Conversion, Bits)
 {
     unsigned result = 13925428;
@@ -177,8 +319,1016 @@ TEST(Conversion, Time)
 
         EXPECT_EQ(pt, time);
     }
+
+    {
+        const boost::posix_time::ptime values[] =
+        {
+            boost::posix_time::ptime(),
+            boost::posix_time::ptime(boost::posix_time::pos_infin),
+            boost::posix_time::ptime(boost::posix_time::neg_infin),
+            boost::posix_time::ptime(boost::gregorian::date(1400, 1, 1)),
+            boost::posix_time::ptime(boost::gregorian::date(9999, 12, 31), boost::posix_time::hours(23) + boost::posix_time::microseconds(999999)),
+            boost::posix_time::ptime(boost::gregorian::date(2014, 10, 15), boost::posix_time::milliseconds(1))
+        };
+
+        for (const auto& value : values)
+            EXPECT_EQ(conv::cast<std::string>(value), boost::posix_time::to_iso_extended_string(value));
+
+        EXPECT_TRUE(conv::cast<boost::posix_time::ptime>("garbage").is_not_a_date_time());
+        EXPECT_EQ(conv::cast<boost::posix_time::ptime>("2014-10-15T17:41:52.724658"), conv::cast<boost::posix_time::ptime>("2014-10-15T17:41:52.724658Z"));
+    }
+
+    {
+        using boost::posix_time::ptime;
+
+        const ptime time(boost::gregorian::date(2014, 11, 12), boost::posix_time::time_duration(6, 34, 20));
+        EXPECT_EQ(conv::cast<ptime>("2014-11-12T09:34:20+03:00"), time);
+        EXPECT_EQ(conv::cast<ptime>("2014-11-12t06:34:20z"), time);
+        EXPECT_EQ(conv::cast<ptime>("2014-11-12 01:04:20-05:30"), time);
+        EXPECT_EQ(conv::cast<ptime>("2014-11-13T00:04:20+17:30"), time);
+        EXPECT_EQ(conv::cast<ptime>("2014-11-12T06:34:20.123456789Z"), time + boost::posix_time::microseconds(123456));
+        EXPECT_EQ(conv::cast<ptime>("2014-11-12T06:34:20.1+00:00"), time + boost::posix_time::milliseconds(100));
+        EXPECT_EQ(conv::cast<ptime>("2016-12-31T23:59:60Z"), ptime(boost::gregorian::date(2017, 1, 1)));
+
+        const char* invalid[] = { "2014-11-12T06:34:20+3:00", "2014-11-12T06:34:20+03:00Z", "2014-11-12T06:34:20+24:00", "1400-01-01T00:00:00+00:01", "2014-13-12",
+            "2014-11-12x06:34:20", " 2014-11-12T06:34:20", "2014-11-12T07", "2014-11-12T24:00:01", "2014-11-12T06:34:20.5+3:00", "9999-12-31T24:00:00" };
+        for (const char* value : invalid)
+            EXPECT_TRUE(conv::cast<ptime>(std::string(value)).is_not_a_date_time()) << value;
+
+        // forms outside RFC 3339 read as they did before it
+        EXPECT_EQ(conv::cast<ptime>("2014-11-12"), ptime(boost::gregorian::date(2014, 11, 12)));
+        EXPECT_EQ(conv::cast<ptime>("2014-11-12T06:34"), time - boost::posix_time::seconds(20));
+        EXPECT_EQ(conv::cast<ptime>("2014-11-12T24:00:00"), ptime(boost::gregorian::date(2014, 11, 13)));
+        EXPECT_EQ(conv::cast<ptime>("2014-11-12T06:34:20."), time);
+        EXPECT_EQ(conv::cast<ptime>("2014-11-12T06:34:20.abc"), time);
+        EXPECT_EQ(conv::cast<ptime>("2014-11-12T06:34:20.5 UTC"), time + boost::posix_time::milliseconds(500));
+        EXPECT_EQ(conv::cast<ptime>("2014-11-12 24:00:00Z"), ptime(boost::gregorian::date(2014, 11, 13)));
+        const char* legacy[] = { "2014-11-12", "2014-11-12T06:34", "2014-11-12T24:00:00", "2014-11-12T06:34:20.", "2014-11-12T06:34:20.abc" };
+        for (const char* value : legacy)
+            EXPECT_EQ(conv::cast<ptime>(std::string(value)), conv::cast<conv::StrictTime>(std::string(value))) << value;
+
+        conv::TimestampParser parser;
+        const char* lines[] = { "2014-11-12T06:34:20Z", "2014-11-12T06:59:59.999+00:00", "garbage", "2014-11-12T06:60:00", "2014-11-12T06:00:00.5",
+            "2014-11-12T07:00:00", "2014-11-12 07:00:00", "2014-11-12T07:00:00", "2014-11-12T07", "2014-11-13T07:00:00-01:00", "2014-11-13", "2014-11-13T24:00:00", "2014-11-13T07:30", "2014-11-13T07:30:00." };
+        for (const char* line : lines)
+            EXPECT_EQ(parser(std::string(line)), conv::cast<ptime>(std::string(line))) << line;
+
+        EXPECT_EQ(conv::cast<conv::StrictTime>("2014-11-12T06:34:20Z"), time);
+        EXPECT_EQ(conv::cast<conv::StrictTime>("2014-11-12"), ptime(boost::gregorian::date(2014, 11, 12)));
+        EXPECT_TRUE(conv::cast<conv::StrictTime>("2014-11-12T09:34:20+03:00").is_not_a_date_time());
+    }
+
+    {
+        using boost::posix_time::ptime;
+
+        const ptime epoch(boost::gregorian::date(1970, 1, 1));
+        const ptime time(boost::gregorian::date(2014, 10, 15), boost::posix_time::time_duration(17, 41, 52, 724658));
+
+        static_assert(std::is_same<decltype(conv::cast<boost::uint32_t>(time)), boost::uint32_t>::value, "seconds since epoch are 32 bit");
+
+        EXPECT_EQ(conv::cast<boost::uint64_t>(epoch), 0u);
+        EXPECT_EQ(conv::cast<boost::uint64_t>(time), 1413394912724u);
+        EXPECT_EQ(conv::cast<boost::uint32_t>(time), 1413394912u);
+        EXPECT_EQ(conv::cast<conv::EpochMicroseconds>(time), 1413394912724658u);
+        EXPECT_EQ(conv::cast<conv::EpochNanoseconds>(time), 1413394912724658000u);
+
+        EXPECT_EQ(conv::cast<ptime>(boost::uint64_t(1413394912724)), time - boost::posix_time::microseconds(658));
+        EXPECT_EQ(conv::cast<ptime>(boost::uint32_t(1413394912)), time - boost::posix_time::microseconds(724658));
+        EXPECT_EQ((conv::cast<ptime, conv::EpochMicroseconds>(1413394912724658u)), time);
+        EXPECT_EQ((conv::cast<ptime, conv::EpochNanoseconds>(1413394912724658999u)), time);
+
+        EXPECT_THROW(conv::cast<boost::uint64_t>(ptime()), conv::CastException);
+        EXPECT_THROW(conv::cast<conv::EpochMicroseconds>(ptime(boost::posix_time::pos_infin)), conv::CastException);
+
+        // counts the target can not hold throw instead of wrapping
+        const ptime before(boost::gregorian::date(1969, 12, 31));
+        EXPECT_THROW(conv::cast<boost::uint64_t>(before), conv::CastException);
+        EXPECT_THROW(conv::cast<boost::uint32_t>(before), conv::CastException);
+        EXPECT_THROW(conv::cast<conv::EpochNanoseconds>(before), conv::CastException);
+        EXPECT_EQ(conv::cast<boost::uint64_t>(ptime(boost::gregorian::date(2200, 1, 1))), 7258118400000u);
+        EXPECT_THROW(conv::cast<boost::uint32_t>(ptime(boost::gregorian::date(2200, 1, 1))), conv::CastException);
+        EXPECT_EQ(conv::cast<boost::uint32_t>(ptime(boost::gregorian::date(2106, 2, 7), boost::posix_time::time_duration(6, 28, 15))), 4294967295u);
+        EXPECT_EQ(conv::cast<conv::EpochMicroseconds>(ptime(boost::gregorian::date(2300, 1, 1))), 10413792000000000u);
+        EXPECT_THROW(conv::cast<conv::EpochNanoseconds>(ptime(boost::gregorian::date(2300, 1, 1))), conv::CastException);
+        EXPECT_THROW(conv::cast<ptime>(boost::uint64_t(-1)), conv::CastException);
+        EXPECT_THROW((conv::cast<ptime, conv::EpochMicroseconds>(boost::uint64_t(253402300800000000))), conv::CastException);
+        EXPECT_EQ((conv::cast<ptime, conv::EpochMicroseconds>(boost::uint64_t(253402300799999999))), ptime(boost::gregorian::date(9999, 12, 31), boost::posix_time::time_duration(23, 59, 59, 999999)));
+
+        std::vector<ptime> times;
+        for (int i = 0; i < 100; ++i)
+            times.push_back(time + boost::posix_time::seconds(i * 3571) - boost::posix_time::hours(i * 1000));
+
+        std::vector<boost::uint64_t> micros(times.size());
+        conv::cast<conv::EpochMicroseconds>(times.data(), times.data() + times.size(), micros.data());
+        std::vector<boost::uint32_t> seconds(times.size());
+        conv::cast<boost::uint32_t>(times.data(), times.data() + times.size(), seconds.data());
+        for (std::size_t i = 0; i < times.size(); ++i)
+        {
+            EXPECT_EQ(micros[i], conv::cast<conv::EpochMicroseconds>(times[i]));
+            EXPECT_EQ(seconds[i], conv::cast<boost::uint32_t>(times[i]));
+        }
+
+        std::vector<ptime> back(times.size());
+        conv::cast<ptime, conv::EpochMicroseconds>(micros.data(), micros.data() + micros.size(), back.data());
+        EXPECT_EQ(back, times);
+
+        times.back() = ptime();
+        EXPECT_THROW(conv::cast<boost::uint64_t>(times.data(), times.data() + times.size(), micros.data()), conv::CastException);
+        times.back() = before;
+        EXPECT_THROW(conv::cast<boost::uint64_t>(times.data(), times.data() + times.size(), micros.data()), conv::CastException);
+    }
+    {
+        using boost::posix_time::ptime;
+
+        const ptime time = conv::cast<ptime>("2014-10-15T17:41:52.724658Z");
+        const ptime second = time - boost::posix_time::microseconds(724658);
+        const ptime milli = time - boost::posix_time::microseconds(658);
+
+        EXPECT_EQ((conv::cast<ptime, conv::AnyTimestamp>("1413394912")), second);
+        EXPECT_EQ((conv::cast<ptime, conv::AnyTimestamp>("1413394912724")), milli);
+        EXPECT_EQ((conv::cast<ptime, conv::AnyTimestamp>("1413394912724658")), time);
+        EXPECT_EQ((conv::cast<ptime, conv::AnyTimestamp>("1413394912724658999")), time);
+        EXPECT_EQ((conv::cast<ptime, conv::AnyTimestamp>("1413394912.724658")), time);
+        EXPECT_EQ((conv::cast<ptime, conv::AnyTimestamp>("1413394912.7")), milli - boost::posix_time::milliseconds(24));
+        EXPECT_EQ((conv::cast<ptime, conv::AnyTimestamp>("2014-10-15T20:41:52.724658+03:00")), time);
+        EXPECT_EQ((conv::cast<ptime, conv::AnyTimestamp>("0")), ptime(boost::gregorian::date(1970, 1, 1)));
+        EXPECT_EQ((conv::cast<ptime, conv::AnyTimestamp>("2014-10-15")), ptime(boost::gregorian::date(2014, 10, 15)));
+
+        const char* invalid[] = { "", "-1413394912", "1413394912.", "14133949127246589990", "9999999999999999999", "1413394912x", "14133949127.5", "2014/10/15T17:41:52", " 1413394912" };
+        for (const char* value : invalid)
+            EXPECT_TRUE((conv::cast<ptime, conv::AnyTimestamp>(std::string(value))).is_not_a_date_time()) << value;
+
+        const std::vector<std::string> column = { "2014-10-15T17:41:52.724658Z", "1413394912", "2014-10-15T17:41:53Z", "bad", "1413394912724", "2014-10-15T18:00:00Z" };
+        std::vector<ptime> result(column.size());
+        conv::cast<ptime, conv::AnyTimestamp>(column.data(), column.data() + column.size(), result.data());
+        for (std::size_t i = 0; i < column.size(); ++i)
+            EXPECT_EQ(result[i], (conv::cast<ptime, conv::AnyTimestamp>(column[i]))) << column[i];
+    }
+}
+
+TEST(Conversion, Duration)
+{
+    using namespace boost::posix_time;
+
+    {
+        const time_duration values[] = { time_duration(0, 0, 0), time_duration(17, 41, 52, 724658), -time_duration(1, 2, 3, 500), hours(1000) + microseconds(1), microseconds(-1), time_duration(not_a_date_time), time_duration(pos_infin), time_duration(neg_infin) };
+        for (const time_duration& value : values)
+        {
+            EXPECT_EQ(conv::cast<std::string>(value), to_simple_string(value));
+            EXPECT_EQ(conv::cast<std::string>(conv::cast<time_duration>(conv::cast<std::string>(value))), to_simple_string(value));
+        }
+    }
+
+    EXPECT_EQ(conv::cast<time_duration>("1:02:03.0045"), time_duration(1, 2, 3) + microseconds(4500));
+    EXPECT_EQ(conv::cast<time_duration>("-00:00:01.123456"), -(seconds(1) + microseconds(123456)));
+    EXPECT_EQ(conv::cast<time_duration>("00:00:00.5000000001"), milliseconds(500));
+    EXPECT_EQ(conv::cast<time_duration>("123456:00:00"), hours(123456));
+
+    const char* invalid[] = { "", "1:2:3", "00:60:00", "00:00:60", "00:00:00.", "00:00:00Z", "+00:00:00", "infinity", "999999999999:00:00" };
+    for (const char* value : invalid)
+        EXPECT_THROW(conv::cast<time_duration>(std::string(value)), conv::CastException) << value;
+
+    EXPECT_EQ(conv::cast<boost::int64_t>(time_duration(1, 2, 3) + microseconds(4999)), 3723004);
+    EXPECT_EQ(conv::cast<boost::int64_t>(-milliseconds(1500)), -1500);
+    EXPECT_EQ(conv::cast<boost::int32_t>(-(seconds(1) + microseconds(999999))), -1);
+    EXPECT_EQ(conv::cast<time_duration>(boost::int64_t(-3723004)), -(time_duration(1, 2, 3) + milliseconds(4)));
+    EXPECT_EQ(conv::cast<time_duration>(boost::int32_t(86400)), hours(24));
+    EXPECT_THROW(conv::cast<boost::int64_t>(time_duration(not_a_date_time)), conv::CastException);
+
+    // counts the other side can not hold throw instead of truncating or wrapping
+    EXPECT_EQ(conv::cast<boost::int32_t>(time_duration(seconds(std::numeric_limits<boost::int32_t>::max()))), std::numeric_limits<boost::int32_t>::max());
+    EXPECT_EQ(conv::cast<boost::int32_t>(time_duration(seconds(std::numeric_limits<boost::int32_t>::min()))), std::numeric_limits<boost::int32_t>::min());
+    EXPECT_THROW(conv::cast<boost::int32_t>(time_duration(hours(24 * 365 * 70))), conv::CastException);
+    EXPECT_THROW(conv::cast<boost::int32_t>(-hours(24 * 365 * 70)), conv::CastException);
+    EXPECT_EQ(conv::cast<time_duration>(std::numeric_limits<boost::int32_t>::min()), seconds(std::numeric_limits<boost::int32_t>::min()));
+    EXPECT_EQ(conv::cast<boost::int64_t>(conv::cast<time_duration>(std::numeric_limits<boost::int64_t>::max() / 1000)), std::numeric_limits<boost::int64_t>::max() / 1000);
+    EXPECT_THROW(conv::cast<time_duration>(std::numeric_limits<boost::int64_t>::max()), conv::CastException);
+    EXPECT_THROW(conv::cast<time_duration>(std::numeric_limits<boost::int64_t>::min()), conv::CastException);
+    EXPECT_THROW(conv::cast<time_duration>(std::numeric_limits<boost::int64_t>::max() / 1000 + 1), conv::CastException);
+}
+
+TEST(Conversion, Date)
+{
+    using boost::gregorian::date;
+
+    {
+        const date values[] = { date(2014, 10, 15), date(1400, 1, 1), date(9999, 12, 31), date(2000, 2, 29), date(1969, 12, 31) };
+        for (const date& value : values)
+        {
+            EXPECT_EQ(conv::cast<std::string>(value), boost::gregorian::to_iso_extended_string(value));
+            EXPECT_EQ(conv::cast<date>(conv::cast<std::string>(value)), value);
+            EXPECT_EQ(conv::cast<date>(conv::cast<boost::int32_t>(value)), value);
+        }
+    }
+
+    EXPECT_EQ(conv::cast<boost::int32_t>(date(1970, 1, 1)), 0);
+    EXPECT_EQ(conv::cast<boost::int32_t>(date(2014, 10, 15)), 16358);
+    EXPECT_EQ(conv::cast<boost::int32_t>(date(1969, 12, 31)), -1);
+    EXPECT_EQ(conv::cast<boost::int32_t>(date(1400, 1, 1)), -208188);
+    EXPECT_EQ(conv::cast<std::string>(date(boost::gregorian::not_a_date_time)), "not-a-date-time");
+    EXPECT_TRUE(conv::cast<date>("+infinity").is_pos_infinity());
+
+    const char* invalid[] = { "", "2014-10-1", "2014-10-015", "2014/10/15", "2014-13-01", "2014-02-29", "1399-12-31", "2014-10-15T00", "infinity" };
+    for (const char* value : invalid)
+        EXPECT_THROW(conv::cast<date>(std::string(value)), conv::CastException) << value;
+
+    EXPECT_THROW(conv::cast<boost::int32_t>(date(boost::gregorian::pos_infin)), conv::CastException);
+    EXPECT_THROW(conv::cast<date>(boost::int32_t(2932897)), conv::CastException);
+    EXPECT_THROW(conv::cast<date>(boost::int32_t(-208189)), conv::CastException);
+}
+
+TEST(Conversion, Chrono)
+{
+    using namespace std::chrono;
+
+    typedef time_point<system_clock, microseconds> Micros;
+    typedef time_point<system_clock, nanoseconds> Nanos;
+    typedef time_point<system_clock, seconds> Seconds;
+
+    {
+        const Micros time(microseconds(1413394912724658));
+        EXPECT_EQ(conv::cast<std::string>(time), "2014-10-15T17:41:52.724658");
+        EXPECT_EQ(conv::cast<Micros>("2014-10-15T17:41:52.724658"), time);
+        EXPECT_EQ(conv::cast<Micros>("2014-10-15T17:41:52.724658999Z"), time);
+        EXPECT_EQ(conv::cast<std::string>(time_point_cast<nanoseconds>(time)), "2014-10-15T17:41:52.724658000");
+        EXPECT_EQ(conv::cast<std::string>(time_point_cast<seconds>(time)), "2014-10-15T17:41:52");
+        EXPECT_EQ(conv::cast<std::string>(time_point_cast<milliseconds>(time)), "2014-10-15T17:41:52.724");
+
+        EXPECT_EQ(conv::cast<boost::uint64_t>(time), 1413394912724u);
+        EXPECT_EQ(conv::cast<boost::uint32_t>(time), 1413394912u);
+        EXPECT_EQ(conv::cast<conv::EpochMicroseconds>(time), 1413394912724658u);
+        EXPECT_EQ(conv::cast<conv::EpochNanoseconds>(time), 1413394912724658000u);
+        EXPECT_EQ(conv::cast<Micros>(boost::uint64_t(1413394912724)), Micros(microseconds(1413394912724000)));
+        EXPECT_EQ(conv::cast<Seconds>(boost::uint32_t(1413394912)), Seconds(seconds(1413394912)));
+        EXPECT_EQ((conv::cast<Micros, conv::EpochMicroseconds>(1413394912724658u)), time);
+        EXPECT_EQ((conv::cast<Nanos, conv::EpochNanoseconds>(1413394912724658001u)), Nanos(nanoseconds(1413394912724658001)));
+    }
+
+    {
+        const char* values[] = { "1970-01-01T00:00:00", "1969-12-31T23:59:59.500000", "1400-01-01T00:00:00", "9999-12-31T23:59:59.999999", "2000-02-29T12:00:00.000001" };
+        for (const char* value : values)
+            EXPECT_EQ(conv::cast<std::string>(conv::cast<Micros>(std::string(value))), value);
+
+        EXPECT_EQ(conv::cast<Micros>("1969-12-31T23:59:59.5").time_since_epoch().count(), -500000);
+
+        const auto now = time_point_cast<microseconds>(system_clock::now());
+        EXPECT_EQ(conv::cast<std::string>(now), conv::cast<std::string>(conv::cast<boost::posix_time::ptime, conv::EpochMicroseconds>(conv::cast<conv::EpochMicroseconds>(now))));
+    }
+
+    {
+        const char* invalid[] = { "", "2014-10-15", "2014-10-15 17:41:52", "2014-13-15T17:41:52", "2014-02-29T17:41:52", "2014-10-15T24:00:00", "2014-10-15T17:41:52.", "2014-10-15T17:41:52x", "2014-10-15T17:41:52ZZ" };
+        for (const char* value : invalid)
+            EXPECT_THROW(conv::cast<Micros>(std::string(value)), conv::CastException) << value;
+
+        EXPECT_THROW(conv::cast<Nanos>("2300-01-01T00:00:00"), conv::CastException);
+        EXPECT_THROW(conv::cast<std::string>(Seconds(seconds(-62167219201))), conv::CastException);
+    }
+
+    {
+        EXPECT_EQ(conv::cast<std::string>(seconds(0)), "00:00:00");
+        EXPECT_EQ(conv::cast<std::string>(milliseconds(3723004)), "01:02:03.004");
+        EXPECT_EQ(conv::cast<std::string>(-microseconds(500)), "-00:00:00.000500");
+        EXPECT_EQ(conv::cast<std::string>(hours(1000)), "1000:00:00");
+        EXPECT_EQ(conv::cast<std::string>(duration<boost::int64_t, std::ratio<1, 1024> >(1536)), "00:00:01.500000000");
+
+        EXPECT_EQ(conv::cast<milliseconds>("01:02:03.004"), milliseconds(3723004));
+        EXPECT_EQ(conv::cast<microseconds>("-00:00:00.0005"), -microseconds(500));
+        EXPECT_EQ(conv::cast<seconds>("1000:00:00.9"), seconds(3600000));
+        EXPECT_EQ(conv::cast<nanoseconds>(conv::cast<std::string>(nanoseconds(-123456789012345))), nanoseconds(-123456789012345));
+
+        const char* invalid[] = { "", ":00:00", "00:60:00", "00:00:60", "00:00", "00:00:00.", "+00:00:00", "00:00:00Z" };
+        for (const char* value : invalid)
+            EXPECT_THROW(conv::cast<seconds>(std::string(value)), conv::CastException) << value;
+    }
+}
+
+namespace
+{
+
+struct Berlin { static const char* Name() { return "Europe/Berlin"; } };
+struct BerlinRule { static const char* Name() { return "CET-1CEST,M3.5.0,M10.5.0/3"; } };
+struct Sydney { static const char* Name() { return "Australia/Sydney"; } };
+struct NewYork { static const char* Name() { return "America/New_York"; } };
+struct Moscow { static const char* Name() { return "Europe/Moscow"; } };
+struct Unknown { static const char* Name() { return "Nowhere/Unknown"; } };
+
+boost::posix_time::ptime Utc(const char* value)
+{
+    return conv::cast<boost::posix_time::ptime>(std::string(value));
+}
+
+} // namespace
+
+TEST(Conversion, LocalTime)
+{
+    using boost::posix_time::ptime;
+
+    EXPECT_EQ(conv::cast<conv::LocalTime<Berlin> >(Utc("2014-07-01T12:00:00Z")), Utc("2014-07-01T14:00:00"));
+    EXPECT_EQ(conv::cast<conv::LocalTime<Berlin> >(Utc("2014-01-01T12:00:00.25Z")), Utc("2014-01-01T13:00:00.25"));
+    EXPECT_EQ(conv::cast<conv::LocalTime<Berlin> >(Utc("2014-03-30T00:59:59Z")), Utc("2014-03-30T01:59:59"));
+    EXPECT_EQ(conv::cast<conv::LocalTime<Berlin> >(Utc("2014-03-30T01:00:00Z")), Utc("2014-03-30T03:00:00"));
+    EXPECT_EQ(conv::cast<conv::LocalTime<Berlin> >(Utc("2014-10-26T00:59:59Z")), Utc("2014-10-26T02:59:59"));
+    EXPECT_EQ(conv::cast<conv::LocalTime<Berlin> >(Utc("2014-10-26T01:00:00Z")), Utc("2014-10-26T02:00:00"));
+    EXPECT_EQ(conv::cast<conv::LocalTime<Sydney> >(Utc("2014-01-01T00:00:00Z")), Utc("2014-01-01T11:00:00"));
+    EXPECT_EQ(conv::cast<conv::LocalTime<Sydney> >(Utc("2014-07-01T00:00:00Z")), Utc("2014-07-01T10:00:00"));
+    EXPECT_EQ(conv::cast<conv::LocalTime<NewYork> >(Utc("2030-07-01T12:00:00Z")), Utc("2030-07-01T08:00:00"));
+    EXPECT_EQ(conv::cast<conv::LocalTime<NewYork> >(Utc("2090-12-01T12:00:00Z")), Utc("2090-12-01T07:00:00"));
+    EXPECT_EQ(conv::cast<conv::LocalTime<Moscow> >(Utc("2014-10-25T21:59:59Z")), Utc("2014-10-26T01:59:59"));
+    EXPECT_EQ(conv::cast<conv::LocalTime<Moscow> >(Utc("2014-10-25T22:00:00Z")), Utc("2014-10-26T01:00:00"));
+
+    {
+        // the POSIX rule and the tzdata file agree since the EU rules took effect
+        std::mt19937_64 generator(42);
+        std::uniform_int_distribution<boost::uint32_t> seconds(820454400, 4102444799u);
+        for (int i = 0; i < 10000; ++i)
+        {
+            const boost::uint32_t value = seconds(generator);
+            EXPECT_EQ(conv::cast<conv::LocalTime<BerlinRule> >(value), conv::cast<conv::LocalTime<Berlin> >(value)) << value;
+        }
+    }
+
+    {
+        const ptime local = Utc("2014-10-15T19:41:52.724658");
+        EXPECT_EQ(conv::cast<conv::LocalTime<Berlin> >(boost::uint32_t(1413394912)), Utc("2014-10-15T19:41:52"));
+        EXPECT_EQ(conv::cast<conv::LocalTime<Berlin> >(boost::uint64_t(1413394912724)), Utc("2014-10-15T19:41:52.724"));
+        EXPECT_EQ((conv::cast<conv::LocalTime<Berlin>, conv::EpochMicroseconds>(1413394912724658u)), local);
+        EXPECT_EQ((conv::cast<conv::LocalTime<Berlin>, conv::EpochNanoseconds>(1413394912724658000u)), local);
+    }
+
+    EXPECT_TRUE(conv::cast<conv::LocalTime<Berlin> >(ptime(boost::posix_time::not_a_date_time)).is_not_a_date_time());
+    EXPECT_TRUE(conv::cast<conv::LocalTime<Berlin> >(ptime(boost::posix_time::pos_infin)).is_pos_infinity());
+    EXPECT_NO_THROW(conv::cast<conv::LocalTime<conv::SystemZone> >(Utc("2014-07-01T12:00:00Z")));
+    EXPECT_THROW(conv::cast<conv::LocalTime<Unknown> >(Utc("2014-07-01T12:00:00Z")), conv::CastException);
+}
+
+
+namespace
+{
+
+//! Upstream that counts what the arena takes from it
+class CountingResource : public conv::MemoryResource
+{
+public:
+    CountingResource() : m_Allocations(0), m_Outstanding(0) {}
+
+    std::size_t m_Allocations;
+    std::size_t m_Outstanding;
+
+private:
+    void* DoAllocate(const std::size_t bytes, const std::size_t alignment) override
+    {
+        ++m_Allocations;
+        ++m_Outstanding;
+        return conv::NewDeleteResource()->Allocate(bytes, alignment);
+    }
+
+    void DoDeallocate(void* p, const std::size_t bytes, const std::size_t alignment) override
+    {
+        --m_Outstanding;
+        conv::NewDeleteResource()->Deallocate(p, bytes, alignment);
+    }
+
+    bool DoIsEqual(const conv::MemoryResource& other) const override
+    {
+        return this == &other;
+    }
+};
+
+//! Allocator the library is not compiled for
+template<typename T>
+struct OtherAllocator : std::allocator<T>
+{
+    template<typename U>
+    struct rebind
+    {
+        typedef OtherAllocator<U> other;
+    };
+
+    OtherAllocator() {}
+
+    template<typename U>
+    OtherAllocator(const OtherAllocator<U>&) {}
+};
+
+} // namespace
+
+TEST(Conversion, Allocator)
+{
+    CountingResource upstream;
+    char buffer[64];
+    conv::MonotonicArena arena(buffer, sizeof(buffer), &upstream);
+    const conv::Allocator<char> alloc(&arena);
+
+    {
+        const std::vector<char> binary = {char(255), 0, 1, 2, 3, 4, 5, 25, 64, char(255), 100, -100, -20, -10};
+        const std::string text(binary.begin(), binary.end());
+
+        const conv::String base64 = conv::cast<conv::Base64>(text, alloc);
+        EXPECT_EQ(std::string(base64.begin(), base64.end()), conv::cast<conv::Base64>(text));
+        EXPECT_EQ(base64.get_allocator(), alloc);
+        EXPECT_EQ(upstream.m_Allocations, 0u);
+
+        const conv::Vector<char> decoded = conv::cast<std::vector<char>, conv::Base64>(std::string(base64.begin(), base64.end()), alloc);
+        EXPECT_EQ(std::vector<char>(decoded.begin(), decoded.end()), binary);
+        const conv::Vector<unsigned char> bytes = conv::cast<std::vector<unsigned char> >(std::string(base64.begin(), base64.end()), alloc);
+        EXPECT_EQ(bytes.size(), binary.size());
+        const conv::String encoded = conv::cast<std::string>(binary, alloc);
+        EXPECT_EQ(encoded, base64);
+
+        const conv::String hex = conv::cast<conv::Hex>(binary, alloc);
+        EXPECT_EQ(std::string(hex.begin(), hex.end()), conv::cast<conv::Hex>(binary));
+        const conv::Vector<char> unhex = conv::cast<std::vector<char>, conv::Hex>(conv::cast<conv::Hex>(binary), alloc);
+        EXPECT_EQ(std::vector<char>(unhex.begin(), unhex.end()), binary);
+
+        // the buffer is used up by now, the rest comes in chunks from upstream
+        EXPECT_GT(upstream.m_Allocations, 0u);
+
+        const conv::Vector<boost::uint64_t> numbers = conv::cast<std::vector<boost::uint64_t> >(std::string("1,22,18446744073709551615"), alloc);
+        EXPECT_EQ(std::vector<boost::uint64_t>(numbers.begin(), numbers.end()), (std::vector<boost::uint64_t>{ 1, 22, 18446744073709551615ull }));
+        EXPECT_THROW(conv::cast<std::vector<boost::uint64_t> >(std::string("1,,2"), alloc), conv::CastException);
+        EXPECT_EQ(conv::cast<std::string>(std::vector<boost::uint64_t>{ 5, 0, 7 }, alloc), conv::String("5,0,7", alloc));
+
+        // elements of the list share the allocator of the list
+        const conv::Vector<conv::String> strings = conv::cast<std::vector<std::string> >(std::string("a,,a long field past the small string buffer"), alloc);
+        ASSERT_EQ(strings.size(), 3u);
+        EXPECT_EQ(strings[0], conv::String("a", alloc));
+        EXPECT_TRUE(strings[1].empty());
+        EXPECT_EQ(strings[2].get_allocator(), alloc);
+        EXPECT_EQ(conv::cast<std::string>(std::vector<std::string>{ "x", "", "y" }, alloc), conv::String("x,,y", alloc));
+        EXPECT_EQ(conv::cast<std::vector<std::string> >(std::string(), alloc).size(), 1u);
+
+        const std::wstring wide = L"\x041F\x0440\x0438\x0432\x0435\x0442 \x2116\x0401";
+        const std::string utf8 = "\xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82 \xE2\x84\x96\xD0\x81";
+        const std::string ansi = "\xCF\xF0\xE8\xE2\xE5\xF2 \xB9\xA8";
+        EXPECT_EQ(conv::cast<std::string>(wide, alloc), conv::String(utf8.begin(), utf8.end(), alloc));
+        EXPECT_EQ(conv::cast<std::wstring>(utf8, alloc), conv::WString(wide.begin(), wide.end(), alloc));
+        EXPECT_EQ(conv::cast<std::string>(wide.c_str(), alloc), conv::String(utf8.begin(), utf8.end(), alloc));
+        EXPECT_EQ(conv::cast<std::wstring>(utf8.c_str(), alloc), conv::WString(wide.begin(), wide.end(), alloc));
+        EXPECT_EQ(conv::cast<conv::Ansi>(wide, alloc), conv::String(ansi.begin(), ansi.end(), alloc));
+        EXPECT_EQ((conv::cast<std::wstring, conv::Ansi>(ansi, alloc)), conv::WString(wide.begin(), wide.end(), alloc));
+        EXPECT_EQ((conv::cast<std::string, conv::Ansi>(ansi, alloc)), conv::String(utf8.begin(), utf8.end(), alloc));
+
+        // casters without a direct form copy their result
+        EXPECT_EQ(conv::cast<std::string>(1234567890123ll, alloc), conv::String("1234567890123", alloc));
+
+        // copies do not keep the arena
+        const conv::String copy = base64;
+        EXPECT_EQ(copy.get_allocator(), conv::Allocator<char>());
+    }
+
+    // the results are gone, nothing is left outstanding after the release
+    arena.Release();
+    EXPECT_EQ(upstream.m_Outstanding, 0u);
+
+    conv::MonotonicArena growing(16, &upstream);
+    const conv::String large = conv::cast<conv::Base64>(std::string(100000, 'x'), conv::Allocator<char>(&growing));
+    EXPECT_EQ(std::string(large.begin(), large.end()), conv::cast<conv::Base64>(std::string(100000, 'x')));
+}
+
+TEST(Conversion, CastInto)
+{
+    std::string text;
+    text.reserve(64);
+    const char* const data = text.data();
+
+    conv::cast_into(text, 1234567890123ll);
+    EXPECT_EQ(text, "1234567890123");
+    conv::cast_into(text, -5);
+    EXPECT_EQ(text, "-5");
+    conv::cast_into(text, 0.5);
+    EXPECT_EQ(text, conv::cast<std::string>(0.5));
+    conv::cast_into(text, boost::posix_time::ptime(boost::gregorian::date(2014, 10, 15), boost::posix_time::time_duration(17, 41, 52)));
+    EXPECT_EQ(text, "2014-10-15T17:41:52");
+    conv::cast_into(text, boost::posix_time::ptime());
+    EXPECT_EQ(text, "not-a-date-time");
+    conv::cast_into(text, boost::posix_time::time_duration(-30, 0, 1));
+    EXPECT_EQ(text, "-30:00:01");
+    conv::cast_into(text, boost::gregorian::date(1999, 12, 31));
+    EXPECT_EQ(text, "1999-12-31");
+    conv::cast_into(text, std::chrono::milliseconds(1500));
+    EXPECT_EQ(text, "00:00:01.500");
+    conv::cast_into(text, std::wstring(L"wide"));
+    EXPECT_EQ(text, "wide");
+    conv::cast_into<conv::Ansi>(text, std::wstring(L"\x041F"));
+    EXPECT_EQ(text, "\xCF");
+    conv::cast_into<conv::Base64>(text, std::string("abcd"));
+    EXPECT_EQ(text, "YWJjZA==");
+    conv::cast_into<std::string, conv::Base64>(text, std::string("YWJj"));
+    EXPECT_EQ(text, "abc");
+    conv::cast_into(text, std::vector<boost::uint64_t>{ 1, 2, 3 });
+    EXPECT_EQ(text, "1,2,3");
+    conv::cast_into(text, std::vector<std::string>{ "a", "b" });
+    EXPECT_EQ(text, "a,b");
+    conv::cast_into<conv::Hex>(text, std::vector<char>{ 1, char(255) });
+    EXPECT_EQ(text, "01FF");
+    conv::cast_into(text, true);
+    EXPECT_EQ(text, "true");
+    EXPECT_EQ(text.data(), data);
+
+    // failures leave the target empty
+    EXPECT_THROW((conv::cast_into<std::string, conv::Base64>(text, std::string("Y!=="))), std::exception);
+    EXPECT_TRUE(text.empty());
+    EXPECT_EQ(text.data(), data);
+
+    std::wstring wide;
+    conv::cast_into(wide, 42);
+    EXPECT_EQ(wide, L"42");
+    conv::cast_into(wide, std::string("\xD0\x9F"));
+    EXPECT_EQ(wide, L"\x041F");
+    conv::cast_into<std::wstring, conv::Ansi>(wide, std::string("\xCF"));
+    EXPECT_EQ(wide, L"\x041F");
+
+    std::vector<char> binary(100);
+    const char* const bytes = binary.data();
+    conv::cast_into<std::vector<char>, conv::Base64>(binary, std::string("AAEC"));
+    EXPECT_EQ(binary, (std::vector<char>{ 0, 1, 2 }));
+    conv::cast_into(binary, std::string("AAECAw=="));
+    EXPECT_EQ(binary, (std::vector<char>{ 0, 1, 2, 3 }));
+    conv::cast_into<std::vector<char>, conv::Hex>(binary, std::string("FF00"));
+    EXPECT_EQ(binary, (std::vector<char>{ char(255), 0 }));
+    EXPECT_EQ(binary.data(), bytes);
+
+    std::vector<boost::uint64_t> numbers;
+    conv::cast_into(numbers, std::string("4,5,6"));
+    conv::cast_into(numbers, std::string("7"));
+    EXPECT_EQ(numbers, std::vector<boost::uint64_t>{ 7 });
+    EXPECT_THROW(conv::cast_into(numbers, std::string("1,x")), conv::CastException);
+    EXPECT_TRUE(numbers.empty());
+
+    std::vector<unsigned> bits{ 9 };
+    conv::cast_into(bits, 5u);
+    EXPECT_EQ(bits, (std::vector<unsigned>{ 0, 2 }));
+
+    // strings of a list keep their capacity as well
+    std::vector<std::string> fields;
+    conv::cast_into(fields, std::string("a field longer than the small string buffer,b,c"));
+    const char* const field = fields[0].data();
+    conv::cast_into(fields, std::string("another long field for the same string,d"));
+    EXPECT_EQ(fields, (std::vector<std::string>{ "another long field for the same string", "d" }));
+    EXPECT_EQ(fields[0].data(), field);
+
+    // targets without a capacity are simply assigned
+    int number = 0;
+    conv::cast_into(number, std::string("17"));
+    EXPECT_EQ(number, 17);
+    boost::posix_time::ptime time;
+    conv::cast_into<boost::posix_time::ptime, conv::AnyTimestamp>(time, std::string("1413394912"));
+    EXPECT_EQ(time, conv::cast<boost::posix_time::ptime>(boost::uint32_t(1413394912)));
+
+    // once warmed up a loop takes nothing more from the resource
+    CountingResource resource;
+    {
+        const std::string encoded = conv::cast<conv::Base64>(std::string(91, 'x'));
+        conv::String target(&resource);
+        conv::Vector<char> decoded(&resource);
+        conv::Vector<conv::String> list(&resource);
+        for (int i = 0; i < 100; ++i)
+        {
+            if (i == 1)
+                resource.m_Allocations = 0;
+            conv::cast_into<std::string>(target, boost::posix_time::ptime(boost::gregorian::date(2014, 10, 15), boost::posix_time::microseconds(i)));
+            conv::cast_into<std::string>(target, std::wstring(100 - i % 10, L'x'));
+            conv::cast_into<conv::Base64>(target, std::string(100 - i % 10, 'x'));
+            conv::cast_into<std::vector<char> >(decoded, encoded);
+            conv::cast_into<std::vector<std::string> >(list, std::string("the first field is rather long,second field too is long"));
+        }
+        EXPECT_EQ(resource.m_Allocations, 0u);
+        EXPECT_EQ(std::string(decoded.begin(), decoded.end()), std::string(91, 'x'));
+    }
+}
+
+TEST(Conversion, CastIntoOtherAllocator)
+{
+    // containers of an allocator the compiled casters are not instantiated for are assigned the result
+    typedef std::basic_string<char, std::char_traits<char>, OtherAllocator<char> > Text;
+    Text text;
+    conv::cast_into<std::string>(text, std::wstring(L"wide"));
+    EXPECT_EQ(text, "wide");
+    conv::cast_into<conv::Base64>(text, std::string("abcd"));
+    EXPECT_EQ(text, "YWJjZA==");
+    conv::cast_into<std::string>(text, std::vector<boost::uint64_t>{ 1, 2, 3 });
+    EXPECT_EQ(text, "1,2,3");
+    conv::cast_into<std::string>(text, boost::posix_time::ptime(boost::gregorian::date(2014, 10, 15), boost::posix_time::time_duration(17, 41, 52)));
+    EXPECT_EQ(text, "2014-10-15T17:41:52");
+    conv::cast_into<std::string>(text, boost::gregorian::date(1999, 12, 31));
+    EXPECT_EQ(text, "1999-12-31");
+
+    std::vector<char, OtherAllocator<char> > binary;
+    conv::cast_into<std::vector<char>, conv::Hex>(binary, std::string("FF00"));
+    EXPECT_EQ(binary.size(), 2u);
+    EXPECT_EQ(binary[0], char(255));
+}
+
+TEST(Conversion, Inline)
+{
+    using boost::posix_time::ptime;
+    using boost::posix_time::time_duration;
+    using boost::gregorian::date;
+
+    static_assert(std::is_same<conv::details::TypeTraits<conv::Inline<boost::uint64_t> >::Type, conv::FixedString<20> >::value, "uint64");
+    static_assert(std::is_same<conv::details::TypeTraits<conv::Inline<boost::int64_t> >::Type, conv::FixedString<20> >::value, "int64");
+    static_assert(std::is_same<conv::details::TypeTraits<conv::Inline<ptime> >::Type, conv::FixedString<26> >::value, "ptime");
+    static_assert(std::is_trivially_copyable<conv::FixedString<26> >::value, "no heap behind it");
+
+    EXPECT_EQ(conv::cast<conv::Inline<boost::uint64_t> >(std::numeric_limits<boost::uint64_t>::max()), "18446744073709551615");
+    EXPECT_EQ(conv::cast<conv::Inline<boost::int64_t> >(std::numeric_limits<boost::int64_t>::min()), "-9223372036854775808");
+    EXPECT_EQ(conv::cast<conv::Inline<int> >(std::numeric_limits<int>::min()), "-2147483648");
+    EXPECT_EQ(conv::cast<conv::Inline<unsigned short> >(static_cast<unsigned short>(65535)), "65535");
+    EXPECT_EQ(conv::cast<conv::Inline<unsigned char> >(static_cast<unsigned char>(255)), "255");
+    EXPECT_EQ(conv::cast<conv::Inline<bool> >(false), "false");
+    EXPECT_EQ(conv::cast<conv::Inline<bool> >(true), "true");
+    EXPECT_EQ(conv::cast<conv::Inline<Small> >(Small::High), "200");
+    EXPECT_EQ(conv::cast<conv::Inline<double> >(-std::numeric_limits<double>::denorm_min()), conv::cast<std::string>(-std::numeric_limits<double>::denorm_min()));
+    EXPECT_EQ(conv::cast<conv::Inline<double> >(-2.2250738585072014e-308), conv::cast<std::string>(-2.2250738585072014e-308));
+    EXPECT_EQ(conv::cast<conv::Inline<double> >(0.1), conv::cast<std::string>(0.1));
+    EXPECT_EQ(conv::cast<conv::Inline<float> >(-1.17549435e-38f), conv::cast<std::string>(-1.17549435e-38f));
+    EXPECT_EQ(conv::cast<conv::Inline<float> >(-0.000123456789f), conv::cast<std::string>(-0.000123456789f));
+
+    const ptime time(date(2014, 10, 15), time_duration(17, 41, 52, 724658));
+    EXPECT_EQ(conv::cast<conv::Inline<ptime> >(time), "2014-10-15T17:41:52.724658");
+    EXPECT_EQ(conv::cast<conv::Inline<ptime> >(ptime(date(9999, 12, 31), time_duration(23, 59, 59, 999999))), "9999-12-31T23:59:59.999999");
+    EXPECT_EQ(conv::cast<conv::Inline<ptime> >(ptime()), "not-a-date-time");
+    EXPECT_EQ(conv::cast<conv::Inline<time_duration> >(time_duration(boost::date_time::min_date_time) + time_duration(0, 0, 0, 1)), conv::cast<std::string>(time_duration(boost::date_time::min_date_time) + time_duration(0, 0, 0, 1)));
+    EXPECT_EQ(conv::cast<conv::Inline<time_duration> >(time_duration(-30, 0, 1)), "-30:00:01");
+    EXPECT_EQ(conv::cast<conv::Inline<date> >(date(1999, 12, 31)), "1999-12-31");
+    EXPECT_EQ(conv::cast<conv::Inline<date> >(date(boost::date_time::not_a_date_time)), "not-a-date-time");
+
+    // other sources are cast to the type first
+    EXPECT_EQ(conv::cast<conv::Inline<int> >(std::string("0042")), "42");
+    EXPECT_THROW(conv::cast<conv::Inline<int> >(3000000000ll), conv::CastException);
+
+    const conv::FixedString<26> text = conv::cast<conv::Inline<ptime> >(time);
+    const std::string string = text;
+    const boost::string_view view = text;
+    EXPECT_EQ(string, "2014-10-15T17:41:52.724658");
+    EXPECT_EQ(view.data(), text.data());
+    EXPECT_EQ(view.size(), 26u);
+    EXPECT_EQ(std::strlen(text.c_str()), 26u);
+    EXPECT_EQ(text, std::string("2014-10-15T17:41:52.724658"));
+    EXPECT_NE(text, conv::cast<conv::Inline<ptime> >(ptime()));
+
+    conv::FixedString<3> small;
+    small.assign("abc");
+    EXPECT_EQ(small, "abc");
+    EXPECT_THROW(small.assign("abcd"), std::length_error);
+    EXPECT_THROW(small.push_back('d'), std::length_error);
+    small.clear();
+    EXPECT_TRUE(small.empty());
+}
+
+TEST(Conversion, Cached)
+{
+    typedef conv::CachedCaster<int> Cached;
+    Cached::Clear();
+    const Cached cached;
+
+    EXPECT_EQ(cached("42"), 42);
+    EXPECT_EQ(cached("42"), 42);
+    EXPECT_EQ(cached("-7"), -7);
+    EXPECT_EQ(Cached::Stats().Hits, 1u);
+    EXPECT_EQ(Cached::Stats().Misses, 2u);
+
+    // failures are not remembered
+    EXPECT_THROW(cached("x"), conv::CastException);
+    EXPECT_THROW(cached("x"), conv::CastException);
+    EXPECT_EQ(Cached::Stats().Misses, 4u);
+
+    // keys are the bytes of the input, equal prefixes and hash collisions do not mix
+    typedef conv::CachedCaster<std::vector<char>, std::string, 4> Small;
+    Small::Clear();
+    const Small small;
+    for (int round = 0; round < 3; ++round)
+    {
+        for (int i = 0; i < 64; ++i)
+        {
+            const std::string text(static_cast<std::size_t>(i % 7 + 1), static_cast<char>('a' + i % 26));
+            const std::string encoded = conv::cast<conv::Base64>(text);
+            EXPECT_EQ(small(encoded), std::vector<char>(text.begin(), text.end()));
+        }
+    }
+    EXPECT_EQ(Small::Stats().Hits + Small::Stats().Misses, 192u);
+    EXPECT_GT(Small::Stats().Evictions, 0u);
+    EXPECT_EQ(Small::Stats().Evictions, Small::Stats().Misses - 4);
+
+    // C strings are keyed by their characters, a reused buffer is not mistaken for the old text
+    typedef conv::CachedCaster<int, const char*> Pointer;
+    char buffer[] = "12";
+    EXPECT_EQ(Pointer()(buffer), 12);
+    buffer[0] = '9';
+    EXPECT_EQ(Pointer()(buffer), 92);
+    EXPECT_EQ(Pointer()(static_cast<const char*>("92")), 92);
+    EXPECT_EQ(Pointer::Stats().Hits, 1u);
+    EXPECT_THROW(Pointer()(nullptr), conv::CastException);
+    EXPECT_EQ((conv::CachedCaster<int, wchar_t*>()(const_cast<wchar_t*>(L"-3"))), -3);
+
+    typedef conv::CachedCaster<std::string, boost::posix_time::ptime> Format;
+    Format::Clear();
+    const boost::posix_time::ptime time(boost::gregorian::date(2014, 10, 15), boost::posix_time::time_duration(17, 41, 52, 724658));
+    EXPECT_EQ(Format()(time), "2014-10-15T17:41:52.724658");
+    EXPECT_EQ(Format()(time), "2014-10-15T17:41:52.724658");
+    EXPECT_EQ(Format::Stats().Hits, 1u);
+
+    typedef conv::CachedCaster<std::string, std::wstring> Wide;
+    EXPECT_EQ(Wide()(L"\x041F"), "\xD0\x9F");
+    EXPECT_EQ(Wide()(L"\x041F"), "\xD0\x9F");
+
+    // every thread has its own table
+    std::thread([&]
+    {
+        EXPECT_EQ(Cached::Stats().Misses, 0u);
+        EXPECT_EQ(cached("42"), 42);
+        EXPECT_EQ(Cached::Stats().Misses, 1u);
+    }).join();
+    EXPECT_EQ(Cached::Stats().Misses, 4u);
+}
+
+TEST(Conversion, Lazy)
+{
+    std::string number = "x";
+    const auto value = conv::lazy_cast<int>(number);
+    EXPECT_FALSE(value.IsEvaluated());
+
+    // the cast runs on the first read, failures are tried again
+    EXPECT_THROW(value.Get(), conv::CastException);
+    EXPECT_FALSE(value.IsEvaluated());
+    number = "42";
+    EXPECT_EQ(value.Get(), 42);
+    EXPECT_TRUE(value.IsEvaluated());
+    number = "43";
+    EXPECT_EQ(*value, 42);
+
+    const std::string encoded = "YWJj";
+    const auto decoded = conv::lazy_cast<std::string, conv::Base64>(encoded);
+    EXPECT_EQ(decoded->size(), 3u);
+    EXPECT_EQ(&decoded.Get(), &*decoded);
+    const std::string& text = decoded;
+    EXPECT_EQ(text, "abc");
+
+    const boost::posix_time::ptime time(boost::gregorian::date(2014, 10, 15), boost::posix_time::time_duration(17, 41, 52));
+    const auto inlineText = conv::lazy_cast<conv::Inline<boost::posix_time::ptime> >(time);
+    EXPECT_EQ(*inlineText, "2014-10-15T17:41:52");
+
+    // every thread sees the one result
+    const std::string timestamp = "2014-10-15T17:41:52.724658Z";
+    const auto shared = conv::shared_lazy_cast<boost::posix_time::ptime>(timestamp);
+    std::vector<const boost::posix_time::ptime*> seen(8);
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < seen.size(); ++i)
+        threads.emplace_back([&, i] { seen[i] = &shared.Get(); });
+    for (std::thread& thread : threads)
+        thread.join();
+    EXPECT_TRUE(shared.IsEvaluated());
+    EXPECT_EQ(*shared, conv::cast<boost::posix_time::ptime>(timestamp));
+    for (const boost::posix_time::ptime* result : seen)
+        EXPECT_EQ(result, seen[0]);
+
+    const std::string bad = "not a time";
+    const auto failed = conv::shared_lazy_cast<boost::posix_time::time_duration>(bad);
+    EXPECT_THROW(failed.Get(), conv::CastException);
+    EXPECT_FALSE(failed.IsEvaluated());
+}
+
+namespace geo
+{
+
+//! User type without stream operators, converted through the customization points only
+struct Point
+{
+    int x;
+    int y;
+};
+
+void conv_to_chars(std::string& buffer, const Point& point)
+{
+    buffer += conv::cast<std::string>(point.x);
+    buffer += ';';
+    buffer += conv::cast<std::string>(point.y);
+}
+
+bool conv_from_chars(const char* first, const char* last, Point& point)
+{
+    const char* const separator = std::find(first, last, ';');
+    if (separator == last)
+        return false;
+    point.x = conv::cast<int>(std::string(first, separator), 0);
+    point.y = conv::cast<int>(std::string(separator + 1, last), 0);
+    return true;
+}
+
+enum class Color
+{
+    Red,
+    Green
+};
+
+template<typename Buffer>
+void conv_to_chars(Buffer& buffer, const Color color)
+{
+    const char* const name = color == Color::Red ? "red" : "green";
+    buffer.append(name, name + std::strlen(name));
+}
+
+bool conv_from_chars(const char* first, const char* last, Color& color)
+{
+    const std::string name(first, last);
+    if (name != "red" && name != "green")
+        return false;
+    color = name == "red" ? Color::Red : Color::Green;
+    return true;
+}
+
+} // namespace geo
+
+TEST(Conversion, CustomizationPoint)
+{
+    EXPECT_EQ(conv::cast<std::string>(geo::Point{ 3, -4 }), "3;-4");
+    const geo::Point point = conv::cast<geo::Point>("7;8");
+    EXPECT_EQ(point.x, 7);
+    EXPECT_EQ(point.y, 8);
+    EXPECT_EQ(conv::cast<geo::Point>(std::string("1;2")).y, 2);
+    EXPECT_THROW(conv::cast<geo::Point>("78"), conv::CastException);
+    EXPECT_THROW(conv::cast<geo::Point>(static_cast<const char*>(nullptr)), conv::CastException);
+
+    // enums with the customization points are not written as numbers
+    EXPECT_EQ(conv::cast<std::string>(geo::Color::Green), "green");
+    EXPECT_EQ(conv::cast<geo::Color>("red"), geo::Color::Red);
+    EXPECT_THROW(conv::cast<geo::Color>("1"), conv::CastException);
+    EXPECT_EQ(conv::cast<int>(geo::Color::Green), 1);
+
+    // the string is reused and any buffer the point accepts works
+    std::string text;
+    text.reserve(32);
+    const char* const data = text.data();
+    conv::cast_into(text, geo::Point{ 10, 20 });
+    conv::cast_into(text, geo::Point{ 1, 2 });
+    EXPECT_EQ(text, "1;2");
+    EXPECT_EQ(text.data(), data);
+
+    CountingResource resource;
+    const conv::Allocator<char> alloc(&resource);
+    EXPECT_EQ(conv::cast<std::string>(geo::Color::Red, alloc), "red");
+    EXPECT_EQ(conv::cast<std::string>(geo::Point{ 5, 6 }, alloc), "5;6");
+}
+
+namespace geo
+{
+
+enum class Level
+{
+    Low,
+    High
+};
+
+constexpr std::array<conv::EnumName<Level>, 2> conv_enum_names(Level)
+{
+    return {{ { "low", Level::Low }, { "high", Level::High } }};
+}
+
+} // namespace geo
+
+TEST(Conversion, Literal)
+{
+    // evaluated by the compiler, malformed text here would not compile
+    static_assert(conv::literal_cast<int>("1234567890") == 1234567890, "");
+    static_assert(conv::literal_cast<short>("-32768") == -32768, "");
+    static_assert(conv::literal_cast<unsigned>("+42") == 42, "");
+    static_assert(conv::literal_cast<bool>("true") && !conv::literal_cast<bool>("0"), "");
+    static_assert(conv::literal_cast<geo::Level>("high") == geo::Level::High, "");
+    static_assert(conv::literal_cast<Foo>("1") == Second, "");
+
+    constexpr auto hex = conv::literal_cast<std::array<unsigned char, 4>, conv::Hex>("deadBEEF");
+    static_assert(hex[0] == 0xDE && hex[3] == 0xEF, "");
+    constexpr auto base64 = conv::literal_cast<std::array<char, 2>, conv::Base64>("YWI=");
+    static_assert(base64[0] == 'a' && base64[1] == 'b', "");
+
+    constexpr auto key = conv::literal_cast<std::array<char, 4>, conv::Hex>("00ff7f80");
+    EXPECT_EQ(std::vector<char>(key.begin(), key.end()), (conv::cast<std::vector<char>, conv::Hex>(std::string("00ff7f80"))));
+    constexpr auto secret = conv::literal_cast<std::array<char, 5> >("aGVsbG8=");
+    EXPECT_EQ(std::string(secret.begin(), secret.end()), "hello");
+
+    // the same rules as the runtime casts
+    EXPECT_EQ(conv::cast<std::vector<char> >(std::string("YWI=")), std::vector<char>(base64.begin(), base64.end()));
+    EXPECT_EQ(conv::cast<bool>("1"), conv::literal_cast<bool>("1"));
+    EXPECT_EQ(conv::literal_cast<long long>("-9223372036854775808"), conv::cast<long long>("-9223372036854775808"));
+
+    // outside of constant expressions malformed literals throw
+    EXPECT_THROW(conv::literal_cast<int>("12a"), conv::CastException);
+    EXPECT_THROW(conv::literal_cast<int>(""), conv::CastException);
+    EXPECT_THROW(conv::literal_cast<short>("32768"), conv::CastException);
+    EXPECT_THROW(conv::literal_cast<bool>("yes"), conv::CastException);
+    EXPECT_THROW(conv::literal_cast<geo::Level>("hig"), conv::CastException);
+    EXPECT_THROW(conv::literal_cast<geo::Level>("highest"), conv::CastException);
+    EXPECT_THROW((conv::literal_cast<std::array<char, 2>, conv::Hex>("0g00")), conv::CastException);
+    EXPECT_THROW((conv::literal_cast<std::array<char, 3>, conv::Base64>("YWI=")), conv::CastException);
+    EXPECT_THROW((conv::literal_cast<std::array<char, 2>, conv::Base64>("Y=I=")), conv::CastException);
+}
+
+TEST(Conversion, Pipe)
+{
+    const std::string ansi = "\xcf\xf0\xe8\xe2\xe5\xf2, \xec\xe8\xf0! \x98\x80";
+    const std::wstring wide = conv::cast<std::wstring, conv::Ansi>(ansi);
+
+    std::mt19937 generator(42);
+    std::string bytes(300, '\0');
+    for (char& c : bytes)
+        c = static_cast<char>(generator());
+    const std::string binary = conv::cast<conv::Base64>(bytes);
+
+    // every block size splits the stages somewhere else, including malformed UTF-8 in the random bytes
+    for (const std::size_t block : { 1, 2, 3, 4, 5, 7, 64, 4096 })
+    {
+        EXPECT_EQ((conv::pipe<conv::Ansi, std::string, conv::Base64>(ansi, block)), conv::cast<conv::Base64>(conv::cast<std::string, conv::Ansi>(ansi)));
+        EXPECT_EQ((conv::pipe<std::wstring, std::string, conv::Hex>(wide, block)), conv::cast<conv::Hex>(conv::cast<std::string>(wide)));
+        EXPECT_EQ((conv::pipe<conv::Base64, std::string, std::wstring>(binary, block)), conv::cast<std::wstring>(bytes));
+        EXPECT_EQ((conv::pipe<conv::Hex, std::string, std::wstring, conv::Ansi>(conv::cast<conv::Hex>(conv::cast<std::string>(wide)), block)), ansi.substr(0, ansi.size() - 2) + "\x80");
+        EXPECT_EQ((conv::pipe<std::string, std::vector<char>, conv::Hex>(binary, block)), conv::cast<conv::Hex>(bytes));
+
+        // decoding stops at the padding, as it does for the whole text
+        EXPECT_EQ((conv::pipe<conv::Base64, std::string>("YQ==YWJj", block)), "a");
+        EXPECT_ANY_THROW((conv::pipe<conv::Base64, std::string, std::wstring>("YWJj!WJj", block)));
+        EXPECT_ANY_THROW((conv::pipe<conv::Hex, std::string, std::wstring>("616", block)));
+    }
+
+    EXPECT_TRUE((conv::pipe<conv::Ansi, std::string, conv::Base64>(std::string())).empty());
+    EXPECT_EQ((conv::pipe<std::wstring, std::string>(L"\u20ac", 1)), "\xe2\x82\xac");
 }
 
+namespace
+{
+
+conv::CasterStats Total()
+{
+    conv::CasterStats total = conv::CasterStats();
+    total.Latency.resize(32);
+    for (const auto& caster : conv::stats())
+    {
+        total.Calls += caster.Calls;
+        total.Failures += caster.Failures;
+        total.InputBytes += caster.InputBytes;
+        total.OutputBytes += caster.OutputBytes;
+        std::transform(caster.Latency.begin(), caster.Latency.end(), total.Latency.begin(), total.Latency.begin(), std::plus<boost::uint64_t>());
+    }
+    return total;
+}
+
+} // namespace
+
+TEST(Conversion, Stats)
+{
+    const auto before = Total();
+
+    EXPECT_EQ(conv::cast<std::string>(12345), "12345");
+    EXPECT_EQ(conv::cast<int>("x", -1), -1);
+    EXPECT_EQ(conv::cast<conv::Base64>(std::string("abc")), "YWJj");
+
+    const auto after = Total();
+
+#ifdef CONVERSION_STATS
+    EXPECT_EQ(after.Calls - before.Calls, 3u);
+    EXPECT_EQ(after.Failures - before.Failures, 1u);
+    EXPECT_EQ(after.InputBytes - before.InputBytes, sizeof(int) + 1 + 3);
+    EXPECT_EQ(after.OutputBytes - before.OutputBytes, 5u + 4u);
+
+    const auto successful = [](const conv::CasterStats& stats) { return std::accumulate(stats.Latency.begin(), stats.Latency.end(), boost::uint64_t()); };
+    EXPECT_EQ(successful(after) - successful(before), 2u);
+
+    bool found = false;
+    for (const auto& caster : conv::stats())
+        found = found || (caster.Caster.find("Base64") != std::string::npos && caster.Calls && caster.Latency.size() == 32);
+    EXPECT_TRUE(found);
+
+    // cast and cast_into of one caster are counted in the same row
+    const auto rows = [](const std::string& name)
+    {
+        std::size_t count = 0;
+        boost::uint64_t calls = 0;
+        for (const auto& caster : conv::stats())
+        {
+            if (caster.Caster == name)
+            {
+                ++count;
+                calls += caster.Calls;
+            }
+        }
+        return std::make_pair(count, calls);
+    };
+    const std::string name = boost::core::demangle(typeid(conv::details::Caster<std::string, long>).name());
+    const auto calls = rows(name).second;
+    std::string text;
+    conv::cast_into(text, 7l);
+    EXPECT_EQ(conv::cast<std::string>(8l), "8");
+    EXPECT_EQ(rows(name).first, 1u);
+    EXPECT_EQ(rows(name).second - calls, 2u);
+
+    const auto joined = Total();
+    std::thread([] { conv::cast<std::string>(1); }).join();
+    EXPECT_EQ(Total().Calls - joined.Calls, 1u);
+#else
+    EXPECT_EQ(after.Calls, 0u);
+    EXPECT_EQ(before.Calls, 0u);
+    EXPECT_TRUE(conv::stats().empty());
+#endif
+}
 
 
 GTEST_API_ int main(int argc, char **argv) 